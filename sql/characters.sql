@@ -227,7 +227,8 @@ CREATE TABLE `character_honor_cp` (
   `honor` float NOT NULL DEFAULT '0',
   `date` int(11) unsigned NOT NULL DEFAULT '0',
   `type` tinyint(3) unsigned NOT NULL DEFAULT '0',
-  KEY `idx_guid` (`guid`)
+  KEY `idx_guid` (`guid`),
+  KEY `idx_type_date` (`type`,`date`)
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8 ROW_FORMAT=DYNAMIC COMMENT='Player System';
 
 --
@@ -0,0 +1,36 @@
+-- Fills character_honor_cp with a generated week of PvP activity for the weekly honor
+-- standing flush (ObjectMgr::FlushRankPoints). Use it only on a copy of the characters DB:
+-- it adds @kills_per_char honorable and a few dishonorable kills for every existing character.
+-- Then set saved_variables.NextMaintenanceDate in the past and start mangosd, the flush
+-- timing is printed as ">> Flushed all ranking points: ...".
+
+SET @kills_per_char = 200;
+-- same day numbering as World::GetDateByLocalTime(): (tm_year << 16) | tm_yday, ten days ago
+SET @week_begin = (((YEAR(NOW()) - 1900) << 16) | (DAYOFYEAR(NOW()) - 1)) - 10;
+
+DROP PROCEDURE IF EXISTS honor_cp_benchmark_fill;
+DELIMITER //
+CREATE PROCEDURE honor_cp_benchmark_fill()
+BEGIN
+  DECLARE i INT DEFAULT 0;
+  WHILE i < @kills_per_char DO
+    -- honorable kills, victim set
+    INSERT INTO character_honor_cp (guid, victim_type, victim, honor, date, type)
+      SELECT guid, 4, 1 + FLOOR(RAND() * 100000), 10 + FLOOR(RAND() * 300), @week_begin + FLOOR(RAND() * 7), 1
+      FROM characters;
+    -- some bonus honor without victim and some dishonorable kills
+    IF i % 20 = 0 THEN
+      INSERT INTO character_honor_cp (guid, victim_type, victim, honor, date, type)
+        SELECT guid, 0, 0, 50 + FLOOR(RAND() * 200), @week_begin + FLOOR(RAND() * 7), 1
+        FROM characters;
+      INSERT INTO character_honor_cp (guid, victim_type, victim, honor, date, type)
+        SELECT guid, 4, 1 + FLOOR(RAND() * 100000), 0, @week_begin + FLOOR(RAND() * 7), 2
+        FROM characters WHERE RAND() < 0.1;
+    END IF;
+    SET i = i + 1;
+  END WHILE;
+END//
+DELIMITER ;
+
+CALL honor_cp_benchmark_fill();
+DROP PROCEDURE honor_cp_benchmark_fill;
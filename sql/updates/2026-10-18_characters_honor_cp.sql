@@ -0,0 +1,2 @@
+-- weekly honor standing aggregates filter by type and date range
+ALTER TABLE character_honor_cp ADD KEY idx_type_date (type, date);
@@ -0,0 +1,3 @@
+DELETE FROM command WHERE name IN ('debug castbench');
+INSERT INTO command (name, security, help) VALUES
+('debug castbench',3,'Syntax: .debug castbench [#count]\r\n\r\nTime #count casts (default 100000) of self cast aura spells by you: deriving their execution plans, looking the plans up and running the cast checks. Nothing is cast.');
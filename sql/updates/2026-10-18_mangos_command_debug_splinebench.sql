@@ -0,0 +1,3 @@
+DELETE FROM command WHERE name IN ('debug splinebench');
+INSERT INTO command (name, security, help) VALUES
+('debug splinebench',3,'Syntax: .debug splinebench [#count] [#updates]\r\n\r\nTime #updates position updates (default 100) of #count synthetic moving splines (default 5000), one by one and batched as in map updates.');
@@ -0,0 +1,3 @@
+DELETE FROM command WHERE name IN ('debug statupdates');
+INSERT INTO command (name, security, help) VALUES
+('debug statupdates',2,'Syntax: .debug statupdates\r\n\r\nShow how many stat recomputations were requested for the selected unit, how many were computed and how many were skipped by batching.');
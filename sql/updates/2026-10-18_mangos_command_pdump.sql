@@ -0,0 +1,5 @@
+-- .pdump write accepts several characters, .pdump load reads such dumps
+DELETE FROM command WHERE name IN ('pdump load','pdump write');
+INSERT INTO command (name, security, help) VALUES
+('pdump load',3,'Syntax: .pdump load $filename $account [$newname] [$newguid]\r\nLoad character dump from dump file into character list of $account with saved or $newname, with saved (or first free) or $newguid guid. For a dump of several characters $newname and $newguid apply to the first one.'),
+('pdump write',3,'Syntax: .pdump write $filename $playerNameOrGUID [$playerNameOrGUID...]\r\nWrite character dump with name/guid $playerNameOrGUID to file $filename. All listed characters are written to the same file.');
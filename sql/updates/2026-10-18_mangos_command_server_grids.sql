@@ -0,0 +1,3 @@
+DELETE FROM command WHERE name IN ('server grids');
+INSERT INTO command (name, security, help) VALUES
+('server grids',2,'Syntax: .server grids\r\n\r\nShow the number of loaded grids and their estimated memory usage by objects, terrain, vmaps and mmaps.');
@@ -95,6 +95,14 @@ class Grid
             return m_activeGridObjects.size() + i_objects.template Count<ACTIVE_OBJECT>();
         }
 
+        /** Returns the number of grid objects of a specific type within the grid.
+         */
+        template<class SPECIFIC_OBJECT>
+        uint32 GridObjectsCount() const
+        {
+            return i_container.template Count<SPECIFIC_OBJECT>();
+        }
+
         /** Inserts a container type object into the grid.
          */
         template<class SPECIFIC_OBJECT>
@@ -87,7 +87,7 @@ class NGrid
         typedef Grid<ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES> GridType;
 
         NGrid(uint32 id, uint32 x, uint32 y, time_t expiry, bool unload = true)
-            : i_gridId(id), i_x(x), i_y(y), i_cellstate(GRID_STATE_INVALID), i_GridObjectDataLoaded(false)
+            : i_gridId(id), i_x(x), i_y(y), i_cellstate(GRID_STATE_INVALID), i_GridObjectDataLoaded(false), i_lastActiveTime(0)
         {
             i_GridInfo = GridInfo(expiry, unload);
         }
@@ -121,6 +121,9 @@ class NGrid
         bool isGridObjectDataLoaded() const { return i_GridObjectDataLoaded; }
         void setGridObjectDataLoaded(bool pLoaded) { i_GridObjectDataLoaded = pLoaded; }
 
+        time_t GetLastActiveTime() const { return i_lastActiveTime; }
+        void SetLastActiveTime(time_t t) { i_lastActiveTime = t; }
+
         GridInfo* getGridInfoRef() { return &i_GridInfo; }
         const TimeTracker& getTimeTracker() const { return i_GridInfo.getTimeTracker(); }
         bool getUnloadLock() const { return i_GridInfo.getUnloadLock(); }
@@ -166,6 +169,17 @@ class NGrid
             return count;
         }
 
+        template<class SPECIFIC_OBJECT>
+        uint32 GridObjectsCount() const
+        {
+            uint32 count = 0;
+            for (uint32 x = 0; x < N; ++x)
+                for (uint32 y = 0; y < N; ++y)
+                    count += i_cells[x][y].template GridObjectsCount<SPECIFIC_OBJECT>();
+
+            return count;
+        }
+
         template<class SPECIFIC_OBJECT>
         bool AddGridObject(const uint32 x, const uint32 y, SPECIFIC_OBJECT* obj)
         {
@@ -195,6 +209,7 @@ class NGrid
         grid_state_t i_cellstate;
         GridType i_cells[N][N];
         bool i_GridObjectDataLoaded;
+        time_t i_lastActiveTime;                            // when the grid was last left by active objects
 };
 
 #endif
@@ -30,6 +30,7 @@ Bag::Bag(): Item()
     m_valuesCount = CONTAINER_END;
 
     memset(m_bagslot, 0, sizeof(Item*) * MAX_BAG_SIZE);
+    m_usedSlotMask = 0;
 }
 
 Bag::~Bag()
@@ -84,6 +85,7 @@ bool Bag::Create(uint32 guidlow, uint32 itemid, Player const* owner)
         SetGuidValue(CONTAINER_FIELD_SLOT_1 + (i * 2), ObjectGuid());
         m_bagslot[i] = NULL;
     }
+    m_usedSlotMask = 0;
 
     return true;
 }
@@ -106,6 +108,7 @@ bool Bag::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
         delete m_bagslot[i];
         m_bagslot[i] = NULL;
     }
+    m_usedSlotMask = 0;
 
     return true;
 }
@@ -122,9 +125,8 @@ void Bag::DeleteFromDB()
 uint32 Bag::GetFreeSlots() const
 {
     uint32 slots = 0;
-    for (uint32 i = 0; i < GetBagSize(); ++i)
-        if (!m_bagslot[i])
-            ++slots;
+    for (uint32 mask = GetFreeSlotMask(); mask; mask &= mask - 1)
+        ++slots;
 
     return slots;
 }
@@ -137,6 +139,7 @@ void Bag::RemoveItem(uint8 slot)
         m_bagslot[slot]->SetContainer(NULL);
 
     m_bagslot[slot] = NULL;
+    m_usedSlotMask &= ~(1u << slot);
     SetGuidValue(CONTAINER_FIELD_SLOT_1 + (slot * 2), ObjectGuid());
 }
 
@@ -147,6 +150,7 @@ void Bag::StoreItem(uint8 slot, Item* pItem)
     if (pItem)
     {
         m_bagslot[slot] = pItem;
+        m_usedSlotMask |= (1u << slot);
         SetGuidValue(CONTAINER_FIELD_SLOT_1 + (slot * 2), pItem->GetObjectGuid());
         pItem->SetGuidValue(ITEM_FIELD_CONTAINED, GetObjectGuid());
         pItem->SetGuidValue(ITEM_FIELD_OWNER, GetOwnerGuid());
@@ -167,11 +171,7 @@ void Bag::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) cons
 // If the bag is empty returns true
 bool Bag::IsEmpty() const
 {
-    for (uint32 i = 0; i < GetBagSize(); ++i)
-        if (m_bagslot[i])
-            return false;
-
-    return true;
+    return (m_usedSlotMask & ((1u << GetBagSize()) - 1)) == 0;
 }
 
 Item* Bag::GetItemByEntry(uint32 item) const
@@ -50,6 +50,8 @@ class Bag : public Item
         bool IsEmpty() const;
         uint32 GetFreeSlots() const;
         uint32 GetBagSize() const { return GetUInt32Value(CONTAINER_FIELD_NUM_SLOTS); }
+        uint32 GetUsedSlotMask() const { return m_usedSlotMask; }
+        uint32 GetFreeSlotMask() const { return ~m_usedSlotMask & ((1u << GetBagSize()) - 1); }
 
         // DB operations
         // overwrite virtual Item::SaveToDB
@@ -65,6 +67,7 @@ class Bag : public Item
 
         // Bag Storage space
         Item* m_bagslot[MAX_BAG_SIZE];
+        uint32 m_usedSlotMask;                              // bit per non empty m_bagslot
 };
 
 inline Item* NewItemOrBag(ItemPrototype const* proto)
@@ -221,6 +221,10 @@ BattleGround::BattleGround()
     m_PrematureCountDown = false;
     m_PrematureCountDownTimer = 0;
 
+    m_PvpLogDataBuildTime = 0;
+    m_PvpLogDataStatus  = STATUS_NONE;
+    m_PvpLogDataChanged = true;
+
     m_StartDelayTimes[BG_STARTING_EVENT_FIRST]  = BG_START_DELAY_2M;
     m_StartDelayTimes[BG_STARTING_EVENT_SECOND] = BG_START_DELAY_1M;
     m_StartDelayTimes[BG_STARTING_EVENT_THIRD]  = BG_START_DELAY_30S;
@@ -1100,8 +1104,7 @@ void BattleGround::EndBattleGround(Team winner)
 
         BlockMovement(plr);
 
-        sBattleGroundMgr.BuildPvpLogDataPacket(&data, this);
-        plr->GetSession()->SendPacket(&data);
+        plr->GetSession()->SendPacket(&GetPvpLogDataPacket());
 
         BattleGroundQueueTypeId bgQueueTypeId = BattleGroundMgr::BGQueueTypeId(GetTypeID());
         sBattleGroundMgr.BuildBattleGroundStatusPacket(&data, this, plr->GetBattleGroundQueueIndex(bgQueueTypeId), STATUS_IN_PROGRESS, TIME_TO_AUTOREMOVE, GetStartTime());
@@ -1270,6 +1273,8 @@ void BattleGround::RemovePlayerAtLeave(ObjectGuid guid, bool Transport, bool Sen
         m_PlayerScores.erase(itr2);
     }
 
+    SetPvpLogDataChanged();
+
     Player* plr = sObjectMgr.GetPlayer(guid);
 
     if (plr)
@@ -1373,6 +1378,8 @@ void BattleGround::Reset()
     for (BattleGroundScoreMap::const_iterator itr = m_PlayerScores.begin(); itr != m_PlayerScores.end(); ++itr)
         delete itr->second;
     m_PlayerScores.clear();
+
+    SetPvpLogDataChanged();
 }
 
 void BattleGround::StartBattleGround()
@@ -1405,6 +1412,7 @@ void BattleGround::AddPlayer(Player* plr)
 
     // Add to list/maps
     m_Players[guid] = bp;
+    SetPvpLogDataChanged();
 
     UpdatePlayersCountByTeam(team, false);                  // +1 player
 
@@ -1591,6 +1599,9 @@ void BattleGround::UpdatePlayerScore(Player* Source, uint32 type, uint32 value)
     if (itr == m_PlayerScores.end())                        // player not found...
         return;
 
+    if (type != SCORE_DAMAGE_DONE && type != SCORE_HEALING_DONE)
+        SetPvpLogDataChanged();
+
     switch (type)
     {
         case SCORE_KILLING_BLOWS:                           // Killing blows
@@ -1605,7 +1616,7 @@ void BattleGround::UpdatePlayerScore(Player* Source, uint32 type, uint32 value)
         case SCORE_BONUS_HONOR:                             // Honor bonus
             itr->second->BonusHonor += value;
             break;
-			// used only in EY, but in MSG_PVP_LOG_DATA opcode
+			// used only in EY, not shown in scoreboard, but in MSG_PVP_LOG_DATA opcode
 		case SCORE_DAMAGE_DONE:                             // Damage Done
 			itr->second->DamageDone += value;
 			break;
@@ -1618,6 +1629,21 @@ void BattleGround::UpdatePlayerScore(Player* Source, uint32 type, uint32 value)
     }
 }
 
+WorldPacket const& BattleGround::GetPvpLogDataPacket()
+{
+    // final scoreboard is always sent up to date
+    if (m_PvpLogDataStatus != GetStatus() || (m_PvpLogDataChanged &&
+            (GetStatus() == STATUS_WAIT_LEAVE || WorldTimer::getMSTimeDiff(m_PvpLogDataBuildTime, WorldTimer::getMSTime()) >= sWorld.getConfig(CONFIG_UINT32_BATTLEGROUND_SCOREBOARD_UPDATE_INTERVAL))))
+    {
+        sBattleGroundMgr.BuildPvpLogDataPacket(&m_PvpLogData, this);
+        m_PvpLogDataBuildTime = WorldTimer::getMSTime();
+        m_PvpLogDataStatus = GetStatus();
+        m_PvpLogDataChanged = false;
+    }
+
+    return m_PvpLogData;
+}
+
 // some doors aren't despawned so we cannot handle their closing in gameobject::update()
 // it would be nice to correctly implement GO_ACTIVATED state and open/close doors in gameobject code
 void BattleGround::DoorClose(ObjectGuid guid)
@@ -1936,8 +1962,7 @@ void BattleGround::PlayerAddedToBGCheckIfBGIsRunning(Player* plr)
 
     BlockMovement(plr);
 
-    sBattleGroundMgr.BuildPvpLogDataPacket(&data, this);
-    plr->GetSession()->SendPacket(&data);
+    plr->GetSession()->SendPacket(&GetPvpLogDataPacket());
 
     sBattleGroundMgr.BuildBattleGroundStatusPacket(&data, this, plr->GetBattleGroundQueueIndex(bgQueueTypeId), STATUS_IN_PROGRESS, GetEndTime(), GetStartTime());
     plr->GetSession()->SendPacket(&data);
@@ -23,6 +23,7 @@
 #include "SharedDefines.h"
 #include "Map.h"
 #include "ByteBuffer.h"
+#include "WorldPacket.h"
 #include "ObjectGuid.h"
 
 // magic event-numbers
@@ -326,6 +327,9 @@ class BattleGround
         BattleGroundScoreMap::const_iterator GetPlayerScoresEnd() const { return m_PlayerScores.end(); }
         uint32 GetPlayerScoresSize() const { return m_PlayerScores.size(); }
 
+        // MSG_PVP_LOG_DATA for this battleground, rebuilt from scores at most once per Battleground.ScoreboardUpdateInterval
+        WorldPacket const& GetPvpLogDataPacket();
+
         void StartBattleGround();
 
         /* Location */
@@ -492,6 +496,8 @@ class BattleGround
         /* Scorekeeping */
 
         BattleGroundScoreMap m_PlayerScores;                // Player scores
+        // must be called at any change of data shown in scoreboard
+        void SetPvpLogDataChanged() { m_PvpLogDataChanged = true; }
         // must be implemented in BG subclass
         virtual void RemovePlayer(Player* /*player*/, ObjectGuid /*guid*/) {}
 
@@ -525,6 +531,12 @@ class BattleGround
         uint32 m_PrematureCountDownTimer;
         char const* m_Name;
 
+        /* Scoreboard cache */
+        WorldPacket m_PvpLogData;
+        uint32 m_PvpLogDataBuildTime;
+        BattleGroundStatus m_PvpLogDataStatus;              // status at build time, scoreboard format differs after end
+        bool   m_PvpLogDataChanged;
+
         /* Player lists */
         typedef std::deque<ObjectGuid> OfflineQueue;
         OfflineQueue m_OfflineQueue;                        // Player GUID
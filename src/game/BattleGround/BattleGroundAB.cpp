@@ -514,9 +514,11 @@ void BattleGroundAB::UpdatePlayerScore(Player* source, uint32 type, uint32 value
     {
         case SCORE_BASES_ASSAULTED:
             ((BattleGroundABScore*)itr->second)->BasesAssaulted += value;
+            SetPvpLogDataChanged();
             break;
         case SCORE_BASES_DEFENDED:
             ((BattleGroundABScore*)itr->second)->BasesDefended += value;
+            SetPvpLogDataChanged();
             break;
         default:
             BattleGround::UpdatePlayerScore(source, type, value);
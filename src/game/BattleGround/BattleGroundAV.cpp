@@ -387,18 +387,23 @@ void BattleGroundAV::UpdatePlayerScore(Player* source, uint32 type, uint32 value
     {
         case SCORE_GRAVEYARDS_ASSAULTED:
             ((BattleGroundAVScore*)itr->second)->GraveyardsAssaulted += value;
+            SetPvpLogDataChanged();
             break;
         case SCORE_GRAVEYARDS_DEFENDED:
             ((BattleGroundAVScore*)itr->second)->GraveyardsDefended += value;
+            SetPvpLogDataChanged();
             break;
         case SCORE_TOWERS_ASSAULTED:
             ((BattleGroundAVScore*)itr->second)->TowersAssaulted += value;
+            SetPvpLogDataChanged();
             break;
         case SCORE_TOWERS_DEFENDED:
             ((BattleGroundAVScore*)itr->second)->TowersDefended += value;
+            SetPvpLogDataChanged();
             break;
         case SCORE_SECONDARY_OBJECTIVES:
             ((BattleGroundAVScore*)itr->second)->SecondaryObjectives += value;
+            SetPvpLogDataChanged();
             break;
         default:
             BattleGround::UpdatePlayerScore(source, type, value);
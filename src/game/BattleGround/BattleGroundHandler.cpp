@@ -437,9 +437,7 @@ void WorldSession::HandlePVPLogDataOpcode(WorldPacket& /*recv_data*/)
     if (!bg)
         return;
 
-    WorldPacket data;
-    sBattleGroundMgr.BuildPvpLogDataPacket(&data, bg);
-    SendPacket(&data);
+    SendPacket(&bg->GetPvpLogDataPacket());
 
     DEBUG_LOG("WORLD: Sent MSG_PVP_LOG_DATA Message");
 }
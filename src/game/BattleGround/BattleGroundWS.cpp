@@ -579,9 +579,11 @@ void BattleGroundWS::UpdatePlayerScore(Player* source, uint32 type, uint32 value
     {
         case SCORE_FLAG_CAPTURES:                           // flags captured
             ((BattleGroundWGScore*)itr->second)->FlagCaptures += value;
+            SetPvpLogDataChanged();
             break;
         case SCORE_FLAG_RETURNS:                            // flags returned
             ((BattleGroundWGScore*)itr->second)->FlagReturns += value;
+            SetPvpLogDataChanged();
             break;
         default:
             BattleGround::UpdatePlayerScore(source, type, value);
@@ -21,7 +21,39 @@
 #include "World.h"
 #include "Database/DatabaseEnv.h"
 #include "DBCStores.h"
-#include "ProgressBar.h"
+#include "Timer.h"
+#include "Threading.h"
+
+// invalid ids deleted by one statement
+#define CLEANER_DELETE_BATCH_SIZE 500
+
+namespace CharacterDatabaseCleaner
+{
+    typedef void (*CleanupFunction)(bool dryRun);
+
+    // one cleanup stage, stages work on different tables and run in parallel
+    class CleanupTask : public ACE_Based::Runnable
+    {
+        public:
+            CleanupTask(char const* name, CleanupFunction func, bool dryRun) : m_name(name), m_func(func), m_dryRun(dryRun) {}
+
+            void run() override
+            {
+                CharacterDatabase.ThreadStart();            // let thread do safe mySQL requests
+
+                uint32 startTime = WorldTimer::getMSTime();
+                m_func(m_dryRun);
+                sLog.outString("Character database cleanup of %s done in %u ms", m_name, WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime()));
+
+                CharacterDatabase.ThreadEnd();              // free mySQL thread resources
+            }
+
+        private:
+            char const* m_name;
+            CleanupFunction m_func;
+            bool m_dryRun;
+    };
+}
 
 void CharacterDatabaseCleaner::CleanDatabase()
 {
@@ -29,7 +61,9 @@ void CharacterDatabaseCleaner::CleanDatabase()
     if (!sWorld.getConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB))
         return;
 
-    sLog.outString("Cleaning character database...");
+    bool dryRun = sWorld.getConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB_DRY_RUN);
+
+    sLog.outString("Cleaning character database%s...", dryRun ? " (dry run)" : "");
 
     // check flags which clean ups are necessary
     QueryResult* result = CharacterDatabase.PQuery("SELECT cleaning_flags FROM saved_variables");
@@ -38,15 +72,29 @@ void CharacterDatabaseCleaner::CleanDatabase()
     uint32 flags = (*result)[0].GetUInt32();
     delete result;
 
+    uint32 startTime = WorldTimer::getMSTime();
+
     // clean up
+    std::vector<ACE_Based::Thread*> threads;
     if (flags & CLEANING_FLAG_SKILLS)
-        CleanCharacterSkills();
+        threads.push_back(new ACE_Based::Thread(new CleanupTask("skills", &CleanCharacterSkills, dryRun)));
     if (flags & CLEANING_FLAG_SPELLS)
-        CleanCharacterSpell();
-    CharacterDatabase.Execute("UPDATE saved_variables SET cleaning_flags = 0");
+        threads.push_back(new ACE_Based::Thread(new CleanupTask("spells", &CleanCharacterSpell, dryRun)));
+
+    for (std::vector<ACE_Based::Thread*>::const_iterator itr = threads.begin(); itr != threads.end(); ++itr)
+    {
+        (*itr)->wait();
+        delete *itr;
+    }
+
+    sLog.outString("Cleaned character database in %u ms", WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime()));
+
+    // keep the flags so the cleanup is done once the dry run is disabled
+    if (!dryRun)
+        CharacterDatabase.Execute("UPDATE saved_variables SET cleaning_flags = 0");
 }
 
-void CharacterDatabaseCleaner::CheckUnique(const char* column, const char* table, bool (*check)(uint32))
+void CharacterDatabaseCleaner::CheckUnique(const char* column, const char* table, bool (*check)(uint32), bool dryRun)
 {
     QueryResult* result = CharacterDatabase.PQuery("SELECT DISTINCT %s FROM %s", column, table);
     if (!result)
@@ -55,37 +103,42 @@ void CharacterDatabaseCleaner::CheckUnique(const char* column, const char* table
         return;
     }
 
-    bool found = false;
-    std::ostringstream ss;
-    BarGoLink bar(result->GetRowCount());
+    std::vector<uint32> invalid;
     do
     {
-        bar.step();
-
         Field* fields = result->Fetch();
 
         uint32 id = fields[0].GetUInt32();
 
         if (!check(id))
-        {
-            if (!found)
-            {
-                ss << "DELETE FROM " << table << " WHERE " << column << " IN (";
-                found = true;
-            }
-            else
-                ss << ",";
-            ss << id;
-        }
+            invalid.push_back(id);
     }
     while (result->NextRow());
     delete result;
 
-    if (found)
+    if (invalid.empty())
+        return;
+
+    if (dryRun)
     {
+        std::ostringstream ss;
+        for (size_t i = 0; i < invalid.size(); ++i)
+            ss << (i ? "," : "") << invalid[i];
+        sLog.outString("Table %s has " SIZEFMTD " invalid %s values: %s", table, invalid.size(), column, ss.str().c_str());
+        return;
+    }
+
+    for (size_t i = 0; i < invalid.size(); i += CLEANER_DELETE_BATCH_SIZE)
+    {
+        std::ostringstream ss;
+        ss << "DELETE FROM " << table << " WHERE " << column << " IN (";
+        for (size_t j = i; j < invalid.size() && j < i + CLEANER_DELETE_BATCH_SIZE; ++j)
+            ss << (j != i ? "," : "") << invalid[j];
         ss << ")";
         CharacterDatabase.Execute(ss.str().c_str());
     }
+
+    sLog.outString("Table %s: deleted rows with " SIZEFMTD " invalid %s values.", table, invalid.size(), column);
 }
 
 bool CharacterDatabaseCleaner::SkillCheck(uint32 skill)
@@ -93,9 +146,9 @@ bool CharacterDatabaseCleaner::SkillCheck(uint32 skill)
     return sSkillLineStore.LookupEntry(skill);
 }
 
-void CharacterDatabaseCleaner::CleanCharacterSkills()
+void CharacterDatabaseCleaner::CleanCharacterSkills(bool dryRun)
 {
-    CheckUnique("skill", "character_skills", &SkillCheck);
+    CheckUnique("skill", "character_skills", &SkillCheck, dryRun);
 }
 
 bool CharacterDatabaseCleaner::SpellCheck(uint32 spell_id)
@@ -103,7 +156,7 @@ bool CharacterDatabaseCleaner::SpellCheck(uint32 spell_id)
     return sSpellStore.LookupEntry(spell_id);
 }
 
-void CharacterDatabaseCleaner::CleanCharacterSpell()
+void CharacterDatabaseCleaner::CleanCharacterSpell(bool dryRun)
 {
-    CheckUnique("spell", "character_spell", &SpellCheck);
+    CheckUnique("spell", "character_spell", &SpellCheck, dryRun);
 }
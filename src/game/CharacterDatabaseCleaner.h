@@ -32,13 +32,14 @@ namespace CharacterDatabaseCleaner
 
     void CleanDatabase();
 
-    void CheckUnique(const char* column, const char* table, bool (*check)(uint32));
+    // deletes rows with an invalid column value, in dry run mode the rows are only reported
+    void CheckUnique(const char* column, const char* table, bool (*check)(uint32), bool dryRun);
 
     bool SkillCheck(uint32 skill);
     bool SpellCheck(uint32 spell_id);
 
-    void CleanCharacterSkills();
-    void CleanCharacterSpell();
+    void CleanCharacterSkills(bool dryRun);
+    void CleanCharacterSpell(bool dryRun);
 }
 
 #endif
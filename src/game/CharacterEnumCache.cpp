@@ -0,0 +1,148 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "CharacterEnumCache.h"
+#include "Policies/Singleton.h"
+#include "World.h"
+
+INSTANTIATE_SINGLETON_1(CharacterEnumCache);
+
+CharacterEnumCache::CharacterEnumCache() : m_nextExpireCheck(0)
+{
+}
+
+bool CharacterEnumCache::GetCharEnum(uint32 accountId, WorldPacket& data)
+{
+    uint32 lifetime = sWorld.getConfig(CONFIG_UINT32_CHAR_ENUM_CACHE_LIFETIME);
+    if (!lifetime)
+        return false;
+
+    time_t now = time(NULL);
+
+    Guard guard(m_lock);
+
+    AccountEntryMap::iterator itr = m_entries.find(accountId);
+    if (itr != m_entries.end())
+    {
+        CharEnumEntry& entry = itr->second;
+        if (!entry.pending && entry.expireTime > now)
+        {
+            data.Initialize(entry.packet.GetOpcode(), entry.packet.size());
+            data.append(static_cast<ByteBuffer const&>(entry.packet));
+            return true;
+        }
+
+        RemoveEntry(itr);
+    }
+
+    // stores are only accepted for accounts marked here, unanswered marks expire as well
+    m_entries[accountId].expireTime = now + lifetime;
+    return false;
+}
+
+void CharacterEnumCache::StoreCharEnum(uint32 accountId, WorldPacket const& data, std::vector<uint32> const& guids)
+{
+    uint32 lifetime = sWorld.getConfig(CONFIG_UINT32_CHAR_ENUM_CACHE_LIFETIME);
+    if (!lifetime)
+        return;
+
+    time_t now = time(NULL);
+
+    Guard guard(m_lock);
+
+    if (now >= m_nextExpireCheck)
+    {
+        RemoveExpired(now);
+        m_nextExpireCheck = now + lifetime;
+    }
+
+    AccountEntryMap::iterator itr = m_entries.find(accountId);
+    // invalidated while the query was running, the result may be outdated
+    if (itr == m_entries.end() || !itr->second.pending)
+        return;
+
+    CharEnumEntry& entry = itr->second;
+    entry.packet.Initialize(data.GetOpcode(), data.size());
+    entry.packet.append(static_cast<ByteBuffer const&>(data));
+    entry.guids = guids;
+    entry.expireTime = now + lifetime;
+    entry.pending = false;
+
+    for (std::vector<uint32>::const_iterator gItr = guids.begin(); gItr != guids.end(); ++gItr)
+        m_characterAccounts[*gItr] = accountId;
+}
+
+void CharacterEnumCache::InvalidateAccount(uint32 accountId)
+{
+    Guard guard(m_lock);
+
+    AccountEntryMap::iterator itr = m_entries.find(accountId);
+    if (itr != m_entries.end())
+        RemoveEntry(itr);
+}
+
+void CharacterEnumCache::InvalidateCharacter(ObjectGuid guid)
+{
+    Guard guard(m_lock);
+
+    CharacterAccountMap::const_iterator cItr = m_characterAccounts.find(guid.GetCounter());
+    if (cItr != m_characterAccounts.end())
+    {
+        AccountEntryMap::iterator itr = m_entries.find(cItr->second);
+        if (itr != m_entries.end())
+            RemoveEntry(itr);
+        return;
+    }
+
+    // account of the character unknown, it may belong to any running query
+    for (AccountEntryMap::iterator itr = m_entries.begin(); itr != m_entries.end();)
+    {
+        if (itr->second.pending)
+            m_entries.erase(itr++);
+        else
+            ++itr;
+    }
+}
+
+void CharacterEnumCache::InvalidateAll()
+{
+    Guard guard(m_lock);
+
+    m_entries.clear();
+    m_characterAccounts.clear();
+}
+
+void CharacterEnumCache::RemoveEntry(AccountEntryMap::iterator itr)
+{
+    std::vector<uint32> const& guids = itr->second.guids;
+    for (std::vector<uint32>::const_iterator gItr = guids.begin(); gItr != guids.end(); ++gItr)
+        m_characterAccounts.erase(*gItr);
+
+    m_entries.erase(itr);
+}
+
+void CharacterEnumCache::RemoveExpired(time_t now)
+{
+    for (AccountEntryMap::iterator itr = m_entries.begin(); itr != m_entries.end();)
+    {
+        if (itr->second.expireTime <= now)
+            RemoveEntry(itr++);
+        else
+            ++itr;
+    }
+}
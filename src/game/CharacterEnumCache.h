@@ -0,0 +1,79 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __MANGOS_CHARACTERENUMCACHE_H
+#define __MANGOS_CHARACTERENUMCACHE_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+#include "ObjectGuid.h"
+#include "WorldPacket.h"
+
+#include <ace/Thread_Mutex.h>
+
+/**
+ * Per-account cache of SMSG_CHAR_ENUM packets.
+ *
+ * Clients request the character list on every logout and reconnect, the
+ * cache serves these requests without the characters query as long as none
+ * of the account's characters changed. Everything that writes data shown in
+ * the character list must invalidate the account or character.
+ */
+class CharacterEnumCache
+{
+    public:
+        CharacterEnumCache();
+
+        // Copies the cached packet into data, on a miss the account is marked as being queried
+        bool GetCharEnum(uint32 accountId, WorldPacket& data);
+        // Stores a packet built from a query started after a GetCharEnum miss, dropped if invalidated meanwhile
+        void StoreCharEnum(uint32 accountId, WorldPacket const& data, std::vector<uint32> const& guids);
+
+        void InvalidateAccount(uint32 accountId);
+        void InvalidateCharacter(ObjectGuid guid);
+        void InvalidateAll();
+
+    private:
+        struct CharEnumEntry
+        {
+            CharEnumEntry() : expireTime(0), pending(true) {}
+
+            WorldPacket packet;
+            std::vector<uint32> guids;                      // low guids of all characters in the packet
+            time_t expireTime;
+            bool pending;                                   // query running, no packet yet
+        };
+
+        typedef UNORDERED_MAP<uint32, CharEnumEntry> AccountEntryMap;
+        typedef UNORDERED_MAP<uint32, uint32> CharacterAccountMap;
+
+        void RemoveEntry(AccountEntryMap::iterator itr);
+        void RemoveExpired(time_t now);
+
+        AccountEntryMap m_entries;
+        CharacterAccountMap m_characterAccounts;            // low guid -> account of cached characters
+        time_t m_nextExpireCheck;
+
+        typedef ACE_Thread_Mutex LockType;
+        typedef ACE_Guard<LockType> Guard;
+        LockType m_lock;
+};
+
+#define sCharacterEnumCache MaNGOS::Singleton<CharacterEnumCache>::Instance()
+
+#endif
@@ -40,6 +40,7 @@
 #include "Chat.h"
 #include "SpellMgr.h"
 #include "AccountMgr.h"
+#include "CharacterEnumCache.h"
 
 // config option SkipCinematics supported values
 enum CinematicsSkipMode
@@ -94,6 +95,7 @@ bool LoginQueryHolder::Initialize()
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADSKILLS,          "SELECT skill, value, max FROM character_skills WHERE guid = '%u'", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADMAILS,           "SELECT id,messageType,sender,receiver,subject,itemTextId,expire_time,deliver_time,money,cod,checked,stationery,mailTemplateId,has_items FROM mail WHERE receiver = '%u' ORDER BY id DESC", m_guid.GetCounter());
     res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS,     "SELECT data, mail_id, item_guid, item_template FROM mail_items JOIN item_instance ON item_guid = guid WHERE receiver = '%u'", m_guid.GetCounter());
+    res &= SetPQuery(PLAYER_LOGIN_QUERY_LOADPETS,            "SELECT id, entry, level, loyalty, slot, name, PetType FROM character_pet WHERE owner = '%u'", m_guid.GetCounter());
 
     return res;
 }
@@ -132,6 +134,7 @@ void WorldSession::HandleCharEnum(QueryResult* result)
     WorldPacket data(SMSG_CHAR_ENUM, 100);                  // we guess size
 
     uint8 num = 0;
+    std::vector<uint32> guids;
 
     data << num;
 
@@ -141,6 +144,7 @@ void WorldSession::HandleCharEnum(QueryResult* result)
         {
             uint32 guidlow = (*result)[0].GetUInt32();
             DETAIL_LOG("Build enum data for char guid %u from account %u.", guidlow, GetAccountId());
+            guids.push_back(guidlow);
             if (Player::BuildEnumData(result, &data))
                 ++num;
         }
@@ -151,11 +155,20 @@ void WorldSession::HandleCharEnum(QueryResult* result)
 
     data.put<uint8>(0, num);
 
+    sCharacterEnumCache.StoreCharEnum(GetAccountId(), data, guids);
+
     SendPacket(&data);
 }
 
 void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recv_data*/)
 {
+    WorldPacket data;
+    if (sCharacterEnumCache.GetCharEnum(GetAccountId(), data))
+    {
+        SendPacket(&data);
+        return;
+    }
+
     /// get all the data necessary for loading all characters (along with their pets) on the account
     CharacterDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharEnumCallback, GetAccountId(),
                                   //           0               1                2                3                 4                  5                       6                        7
@@ -493,6 +506,8 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
     Player* pCurrChar = new Player(this);
     pCurrChar->GetMotionMaster()->Initialize();
 
+    uint32 loadStartTime = WorldTimer::getMSTime();
+
     // "GetAccountId()==db stored account id" checked in LoadFromDB (prevent login not own character using cheating tools)
     if (!pCurrChar->LoadFromDB(playerGuid, holder))
     {
@@ -503,6 +518,8 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
         return;
     }
 
+    DEBUG_LOG("WORLD: %s loaded from login query results in %u ms", playerGuid.GetString().c_str(), WorldTimer::getMSTimeDiff(loadStartTime, WorldTimer::getMSTime()));
+
     SetPlayer(pCurrChar);
 
     WorldPacket data(SMSG_LOGIN_VERIFY_WORLD, 20);
@@ -652,6 +669,11 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
 
     sObjectAccessor.AddObject(pCurrChar);
     // DEBUG_LOG("Player %s added to Map.",pCurrChar->GetName());
+
+    // from now on receive guild broadcasts
+    if (Guild* guild = sGuildMgr.GetGuildById(pCurrChar->GetGuildId()))
+        guild->SetMemberOnline(pCurrChar);
+
     pCurrChar->GetSocial()->SendFriendList();
     pCurrChar->GetSocial()->SendIgnoreList();
 
@@ -958,6 +980,8 @@ void WorldSession::HandleChangePlayerNameOpcodeCallBack(QueryResult* result, uin
     CharacterDatabase.PExecute("UPDATE characters set name = '%s', at_login = at_login & ~ %u WHERE guid ='%u'", newname.c_str(), uint32(AT_LOGIN_RENAME), guidLow);
     CharacterDatabase.CommitTransaction();
 
+    sCharacterEnumCache.InvalidateAccount(accountId);
+
     sLog.outChar("Account: %d (IP: %s) Character:[%s] (guid:%u) Changed name to: %s", session->GetAccountId(), session->GetRemoteAddress().c_str(), oldname.c_str(), guidLow, newname.c_str());
 
     WorldPacket data(SMSG_CHAR_RENAME, 1 + 8 + (newname.size() + 1));
@@ -203,6 +203,7 @@ class MANGOS_DLL_SPEC ChatHandler
 
         bool HandleDebugAnimCommand(char* args);
         bool HandleDebugBattlegroundCommand(char* args);
+        bool HandleDebugCastBenchCommand(char* args);
         bool HandleDebugGetItemStateCommand(char* args);
         bool HandleDebugGetItemValueCommand(char* args);
         bool HandleDebugGetLootRecipientCommand(char* args);
@@ -215,6 +216,8 @@ class MANGOS_DLL_SPEC ChatHandler
         bool HandleDebugSpellCheckCommand(char* args);
         bool HandleDebugSpellCoefsCommand(char* args);
         bool HandleDebugSpellModsCommand(char* args);
+        bool HandleDebugSplineBenchCommand(char* args);
+        bool HandleDebugStatUpdatesCommand(char* args);
         bool HandleDebugUpdateWorldStateCommand(char* args);
 
         bool HandleDebugPlayCinematicCommand(char* args);
@@ -483,6 +486,7 @@ class MANGOS_DLL_SPEC ChatHandler
 
         bool HandleServerCorpsesCommand(char* args);
         bool HandleServerExitCommand(char* args);
+        bool HandleServerGridsCommand(char* args);
         bool HandleServerIdleRestartCommand(char* args);
         bool HandleServerIdleShutDownCommand(char* args);
         bool HandleServerInfoCommand(char* args);
@@ -100,7 +100,7 @@ namespace MaNGOS
             return prk;
         }
 
-        inline HonorScores GenerateScores(HonorStandingList standingList, uint32 team)
+        inline HonorScores GenerateScores(HonorStandingList const& standingList)
         {
             HonorScores sc;
 
@@ -141,7 +141,7 @@ namespace MaNGOS
 
             // the X values for each breakpoint are found from the CP scores
             // of the players around that point in the WS scores
-            HonorStanding* tempSt;
+            // standing is sorted, so position N is standingList[N - 1]
             float honor;
 
             // initialize CP array
@@ -150,13 +150,12 @@ namespace MaNGOS
             for (uint8 i = 1; i <= 13; i++)
             {
                 honor = 0.0f;
-                tempSt = sObjectMgr.GetHonorStandingByPosition(sc.BRK[i], team);
-                if (tempSt)
+                uint32 pos = uint32(sc.BRK[i]);
+                if (pos && pos <= standingList.size())
                 {
-                    honor += tempSt->honorPoints;
-                    tempSt = sObjectMgr.GetHonorStandingByPosition(sc.BRK[i] + 1, team);
-                    if (tempSt)
-                        honor += tempSt->honorPoints;
+                    honor += standingList[pos - 1].honorPoints;
+                    if (pos < standingList.size())
+                        honor += standingList[pos].honorPoints;
                 }
 
                 sc.FX[i] = honor ? honor / 2 : 0;
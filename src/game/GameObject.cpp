@@ -60,6 +60,9 @@ GameObject::GameObject() : WorldObject(),
     m_spellId = 0;
     m_cooldownTime = 0;
 
+    m_trapTriggerPending = true;
+    m_trapIdleCheckTimer = TRAP_IDLE_CHECK_INTERVAL;
+
     m_captureTimer = 0;
 
     m_groupLootTimer = 0;
@@ -81,6 +84,12 @@ void GameObject::AddToWorld()
     if (m_model)
         GetMap()->InsertGameObjectModel(*m_model);
 
+    if (!IsInWorld() && GetTrapTriggerRadius())
+    {
+        GetMap()->AddTrapTrigger(this);
+        m_trapTriggerPending = true;
+    }
+
     Object::AddToWorld();
 
     // After Object::AddToWorld so that for initial state the GO is added to the world (and hence handled correctly)
@@ -111,6 +120,9 @@ void GameObject::RemoveFromWorld()
         if (m_model && GetMap()->ContainsGameObjectModel(*m_model))
             GetMap()->RemoveGameObjectModel(*m_model);
 
+        if (GetTrapTriggerRadius())
+            GetMap()->RemoveTrapTrigger(this);
+
         GetMap()->GetObjectsStore().erase<GameObject>(GetObjectGuid(), (GameObject*)NULL);
     }
 
@@ -303,7 +315,11 @@ void GameObject::Update(uint32 update_diff, uint32 p_time)
                 if (goInfo->type == GAMEOBJECT_TYPE_TRAP)   // traps
                 {
                     if (m_cooldownTime >= time(NULL))
+                    {
+                        // units already in range must be found when armed
+                        m_trapTriggerPending = true;
                         return;
+                    }
 
                     // FIXME: this is activation radius (in different casting radius that must be selected from spell data)
                     // TODO: move activated state code (cast itself) to GO_ACTIVATED, in this place only check activating and set state
@@ -322,13 +338,22 @@ void GameObject::Update(uint32 update_diff, uint32 p_time)
                         }
                     }
 
-                    // Should trap trigger?
-                    Unit* enemy = NULL;                     // pointer to appropriate target if found any
-                    MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck u_check(this, radius);
-                    MaNGOS::UnitSearcher<MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck> checker(enemy, u_check);
-                    Cell::VisitAllObjects(this, checker, radius);
-                    if (enemy)
-                        Use(enemy);
+                    // Should trap trigger? units moving in range wake the trap up (see Map::NotifyTrapTriggers),
+                    // the idle search only catches units changing hostility or visibility in place
+                    if (!m_trapTriggerPending && m_trapIdleCheckTimer > update_diff)
+                        m_trapIdleCheckTimer -= update_diff;
+                    else
+                    {
+                        m_trapTriggerPending = false;
+                        m_trapIdleCheckTimer = TRAP_IDLE_CHECK_INTERVAL;
+
+                        Unit* enemy = NULL;                 // pointer to appropriate target if found any
+                        MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck u_check(this, radius);
+                        MaNGOS::UnitSearcher<MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck> checker(enemy, u_check);
+                        Cell::VisitAllObjects(this, checker, radius);
+                        if (enemy)
+                            Use(enemy);
+                    }
                 }
 
                 if (uint32 max_charges = goInfo->GetCharges())
@@ -1634,6 +1659,22 @@ void GameObject::UpdateRotationFields(float rotation2 /*=0.0f*/, float rotation3
     SetFloatValue(GAMEOBJECT_ROTATION + 3, rotation3);
 }
 
+float GameObject::GetTrapTriggerRadius() const
+{
+    GameObjectInfo const* goInfo = GetGOInfo();
+    if (goInfo->type != GAMEOBJECT_TYPE_TRAP)
+        return 0.0f;
+
+    if (goInfo->trap.radius)
+        return float(goInfo->trap.radius);
+
+    // battlegrounds gameobjects has data2 == 0 && data5 == 3
+    if (goInfo->trap.cooldown == 3)
+        return float(goInfo->trap.cooldown);
+
+    return 0.0f;
+}
+
 bool GameObject::IsHostileTo(Unit const* unit) const
 {
     // always non-hostile to GM in GM mode
@@ -538,6 +538,9 @@ struct GameObjectDisplayInfoEntry;
 
 #define GO_ANIMPROGRESS_DEFAULT 100                         // in 3.x 0xFF
 
+// armed traps without units moving in range recheck it after this time (msecs)
+#define TRAP_IDLE_CHECK_INTERVAL 1000
+
 class MANGOS_DLL_SPEC GameObject : public WorldObject
 {
     public:
@@ -670,6 +673,11 @@ class MANGOS_DLL_SPEC GameObject : public WorldObject
         void ResetDoorOrButton();
 
         bool IsHostileTo(Unit const* unit) const override;
+
+        // activation radius of traps triggered by units in range, 0 for other gameobjects
+        float GetTrapTriggerRadius() const;
+        // some unit moved into the activation radius
+        void SetTrapTriggerPending() { m_trapTriggerPending = true; }
         bool IsFriendlyTo(Unit const* unit) const override;
 
         void SummonLinkedTrapIfAny();
@@ -699,6 +707,9 @@ class MANGOS_DLL_SPEC GameObject : public WorldObject
         time_t      m_cooldownTime;                         // used as internal reaction delay time store (not state change reaction).
         // For traps/goober this: spell casting cooldown, for doors/buttons: reset time.
 
+        bool        m_trapTriggerPending;                   // trap must search for units in range at next update
+        uint32      m_trapIdleCheckTimer;                   // (msecs) time to next trap search without pending trigger
+
         uint32      m_captureTimer;                         // (msecs) timer used for capture points
         float       m_captureSlider;                        // capture point slider value in range of [0..100]
         CapturePointState m_captureState;
@@ -26,6 +26,7 @@
 #include "GridMap.h"
 #include "VMapFactory.h"
 #include "MoveMap.h"
+#include "MapTree.h"
 #include "World.h"
 #include "Policies/Singleton.h"
 #include "Util.h"
@@ -39,6 +40,18 @@ char const* MAP_LIQUID_MAGIC  = "MLIQ";
 static uint16 holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 static uint16 holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
+static uint32 GetTileFileSize(std::string const& fileName)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file)
+        return 0;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size > 0 ? uint32(size) : 0;
+}
+
 GridMap::GridMap()
 {
     m_flags = 0;
@@ -64,6 +77,8 @@ GridMap::GridMap()
     m_liquidFlags = NULL;
     m_liquidEntry = NULL;
     m_liquid_map  = NULL;
+
+    m_memoryUsage = 0;
 }
 
 GridMap::~GridMap()
@@ -143,6 +158,8 @@ void GridMap::unloadData()
     m_liquidFlags = NULL;
     m_liquid_map  = NULL;
     m_gridGetHeight = &GridMap::getHeightFromFlat;
+
+    m_memoryUsage = 0;
 }
 
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
@@ -158,6 +175,7 @@ bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         m_area_map = new uint16 [16 * 16];
         fread(m_area_map, sizeof(uint16), 16 * 16, in);
+        m_memoryUsage += sizeof(uint16) * 16 * 16;
     }
 
     return true;
@@ -180,6 +198,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             m_uint16_V8 = new uint16 [128 * 128];
             fread(m_uint16_V9, sizeof(uint16), 129 * 129, in);
             fread(m_uint16_V8, sizeof(uint16), 128 * 128, in);
+            m_memoryUsage += sizeof(uint16) * (129 * 129 + 128 * 128);
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             m_gridGetHeight = &GridMap::getHeightFromUint16;
         }
@@ -189,6 +208,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             m_uint8_V8 = new uint8 [128 * 128];
             fread(m_uint8_V9, sizeof(uint8), 129 * 129, in);
             fread(m_uint8_V8, sizeof(uint8), 128 * 128, in);
+            m_memoryUsage += sizeof(uint8) * (129 * 129 + 128 * 128);
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             m_gridGetHeight = &GridMap::getHeightFromUint8;
         }
@@ -198,6 +218,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             m_V8 = new float [128 * 128];
             fread(m_V9, sizeof(float), 129 * 129, in);
             fread(m_V8, sizeof(float), 128 * 128, in);
+            m_memoryUsage += sizeof(float) * (129 * 129 + 128 * 128);
             m_gridGetHeight = &GridMap::getHeightFromFloat;
         }
     }
@@ -239,12 +260,14 @@ bool GridMap::loadGridMapLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
         m_liquidFlags = new uint8[16 * 16];
         fread(m_liquidFlags, sizeof(uint8), 16 * 16, in);
+        m_memoryUsage += (sizeof(uint16) + sizeof(uint8)) * 16 * 16;
     }
 
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
         m_liquid_map = new float [m_liquid_width * m_liquid_height];
         fread(m_liquid_map, sizeof(float), m_liquid_width * m_liquid_height, in);
+        m_memoryUsage += sizeof(float) * m_liquid_width * m_liquid_height;
     }
 
     return true;
@@ -697,6 +720,8 @@ TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
         {
             m_GridMaps[i][k] = NULL;
             m_GridRef[i][k] = 0;
+            m_GridVMapMemory[i][k] = 0;
+            m_GridMMapMemory[i][k] = 0;
         }
     }
 
@@ -769,6 +794,8 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
             if (pMap && iRef == 0)
             {
                 m_GridMaps[x][y] = NULL;
+                m_GridVMapMemory[x][y] = 0;
+                m_GridMMapMemory[x][y] = 0;
                 // delete grid data if reference count == 0
                 pMap->unloadData();
                 delete pMap;
@@ -785,6 +812,42 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
     i_timer.Reset();
 }
 
+void TerrainInfo::GetMemoryUsage(GridMemoryUsage& usage) const
+{
+    for (int y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+    {
+        for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+        {
+            GridMap const* pMap = m_GridMaps[x][y];
+            if (!pMap)
+                continue;
+
+            if (m_GridRef[x][y] == 0)
+            {
+                usage.unreferenced += pMap->GetMemoryUsage() + m_GridVMapMemory[x][y] + m_GridMMapMemory[x][y];
+                continue;
+            }
+
+            usage.terrain += pMap->GetMemoryUsage();
+            usage.vmap += m_GridVMapMemory[x][y];
+            usage.mmap += m_GridMMapMemory[x][y];
+        }
+    }
+}
+
+uint32 TerrainInfo::GetGridMemoryUsage(const uint32 x, const uint32 y) const
+{
+    MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
+    MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
+
+    // terrain shared with other instances of the map stays loaded
+    GridMap const* pMap = m_GridMaps[x][y];
+    if (!pMap || m_GridRef[x][y] > 1)
+        return 0;
+
+    return pMap->GetMemoryUsage() + m_GridVMapMemory[x][y] + m_GridMMapMemory[x][y];
+}
+
 int TerrainInfo::RefGrid(const uint32& x, const uint32& y)
 {
     MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
@@ -1123,6 +1186,8 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y)
             {
                 case VMAP::VMAP_LOAD_RESULT_OK:
                     DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "VMAP loaded name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", mapName, m_mapId, x, y, x, y);
+                    // model geometry is shared between tiles, so only the tile spawn data is accounted to the grid
+                    m_GridVMapMemory[x][y] = GetTileFileSize(sWorld.GetDataPath() + "vmaps/" + VMAP::StaticMapTree::getTileFileName(m_mapId, x, y));
                     break;
                 case VMAP::VMAP_LOAD_RESULT_ERROR:
                     DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Could not load VMAP name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", mapName, m_mapId, x, y, x, y);
@@ -1133,7 +1198,9 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y)
             }
 
             // load navmesh
-            MMAP::MMapFactory::createOrGetMMapManager()->loadMap(m_mapId, x, y);
+            MMAP::MMapManager* mmgr = MMAP::MMapFactory::createOrGetMMapManager();
+            if (mmgr->loadMap(m_mapId, x, y))
+                m_GridMMapMemory[x][y] = mmgr->getLoadedTileDataSize(m_mapId, x, y);
         }
     }
 
@@ -1221,6 +1288,12 @@ void TerrainManager::Update(const uint32 diff)
         iter->second->CleanUpGrids(diff);
 }
 
+void TerrainManager::GetMemoryUsage(GridMemoryUsage& usage) const
+{
+    for (TerrainDataMap::const_iterator iter = i_TerrainMap.begin(); iter != i_TerrainMap.end(); ++iter)
+        iter->second->GetMemoryUsage(usage);
+}
+
 void TerrainManager::UnloadAll()
 {
     for (TerrainDataMap::iterator it = i_TerrainMap.begin(); it != i_TerrainMap.end(); ++it)
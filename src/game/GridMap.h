@@ -154,6 +154,9 @@ class GridMap
         uint8* m_liquidFlags;
         float* m_liquid_map;
 
+        // bytes allocated for the loaded data
+        uint32 m_memoryUsage;
+
         bool loadAreaData(FILE* in, uint32 offset, uint32 size);
         bool loadHeightData(FILE* in, uint32 offset, uint32 size);
         bool loadGridMapLiquidData(FILE* in, uint32 offset, uint32 size);
@@ -179,6 +182,8 @@ class GridMap
         static bool ExistMap(uint32 mapid, int gx, int gy);
         static bool ExistVMap(uint32 mapid, int gx, int gy);
 
+        uint32 GetMemoryUsage() const { return sizeof(GridMap) + m_memoryUsage; }
+
         uint16 getArea(float x, float y);
         float getHeight(float x, float y) { return (this->*m_gridGetHeight)(x, y); }
         float getLiquidLevel(float x, float y);
@@ -186,6 +191,22 @@ class GridMap
         GridMapLiquidStatus getLiquidStatus(float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data = 0);
 };
 
+// estimated memory held by loaded grids, in bytes
+struct GridMemoryUsage
+{
+    GridMemoryUsage() : grids(0), idleGrids(0), objects(0), terrain(0), vmap(0), mmap(0), unreferenced(0) {}
+
+    uint32 grids;
+    uint32 idleGrids;                                       // grids in removal state, candidates for eviction
+    uint64 objects;
+    uint64 terrain;
+    uint64 vmap;
+    uint64 mmap;
+    uint64 unreferenced;                                    // terrain data of unloaded grids waiting for cleanup
+
+    uint64 GetTotal() const { return objects + terrain + vmap + mmap; }
+};
+
 template<typename Countable>
 class MANGOS_DLL_SPEC Referencable
 {
@@ -248,6 +269,11 @@ class MANGOS_DLL_SPEC TerrainInfo : public Referencable<AtomicLong>
         // THIS METHOD IS NOT THREAD-SAFE!!!! AND IT SHOULDN'T BE THREAD-SAFE!!!!
         void CleanUpGrids(const uint32 diff);
 
+        // adds the estimated terrain, vmap and mmap memory of the loaded grids
+        void GetMemoryUsage(GridMemoryUsage& usage) const;
+        // memory freed by the grid cleanup once the last reference to the grid is released
+        uint32 GetGridMemoryUsage(const uint32 x, const uint32 y) const;
+
     protected:
         friend class Map;
         // load/unload terrain data
@@ -268,6 +294,8 @@ class MANGOS_DLL_SPEC TerrainInfo : public Referencable<AtomicLong>
 
         GridMap* m_GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         int16 m_GridRef[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        uint32 m_GridVMapMemory[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        uint32 m_GridMMapMemory[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
         // global garbage collection timer
         ShortIntervalTimer i_timer;
@@ -291,6 +319,8 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
         void Update(const uint32 diff);
         void UnloadAll();
 
+        void GetMemoryUsage(GridMemoryUsage& usage) const;
+
         uint16 GetAreaFlag(uint32 mapid, float x, float y, float z) const
         {
             TerrainInfo* pData = const_cast<TerrainManager*>(this)->LoadTerrain(mapid);
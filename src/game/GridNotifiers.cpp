@@ -133,6 +133,15 @@ void ObjectMessageDeliverer::Visit(CameraMapType& m)
     }
 }
 
+void MonsterMoveDeliverer::Visit(CameraMapType& m)
+{
+    for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        if (WorldSession* session = iter->getSource()->GetOwner()->GetSession())
+            session->QueueMonsterMove(i_message);
+    }
+}
+
 void MessageDistDeliverer::Visit(CameraMapType& m)
 {
     for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -84,6 +84,14 @@ namespace MaNGOS
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
     };
 
+    struct MonsterMoveDeliverer
+    {
+        WorldPacket* i_message;
+        explicit MonsterMoveDeliverer(WorldPacket* msg) : i_message(msg) {}
+        void Visit(CameraMapType& m);
+        template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+    };
+
     struct MessageDistDeliverer
     {
         Player const& i_player;
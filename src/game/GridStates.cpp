@@ -20,6 +20,7 @@
 #include "GridNotifiers.h"
 #include "GameSystem/Grid.h"
 #include "Log.h"
+#include "World.h"
 
 void
 InvalidState::Update(Map&, NGridType&, GridInfo&, const uint32& /*x*/, const uint32& /*y*/, const uint32&) const
@@ -50,6 +51,7 @@ void
 IdleState::Update(Map& m, NGridType& grid, GridInfo&, const uint32& x, const uint32& y, const uint32&) const
 {
     m.ResetGridExpiry(grid);
+    grid.SetLastActiveTime(sWorld.GetGameTime());
     grid.SetGridState(GRID_STATE_REMOVAL);
     DEBUG_LOG("Grid[%u,%u] on map %u moved to IDLE state", x, y, m.GetId());
 }
@@ -57,6 +59,10 @@ IdleState::Update(Map& m, NGridType& grid, GridInfo&, const uint32& x, const uin
 void
 RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, const uint32& y, const uint32& t_diff) const
 {
+    // with a memory budget idle grids are unloaded by MapManager in least recently active order
+    if (sWorld.getConfig(CONFIG_UINT32_GRID_MEMORY_BUDGET))
+        return;
+
     if (!info.getUnloadLock())
     {
         info.UpdateTimeTracker(t_diff);
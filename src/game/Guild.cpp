@@ -29,6 +29,7 @@
 #include "Util.h"
 #include "Language.h"
 #include "World.h"
+#include "CharacterEnumCache.h"
 
 //// MemberSlot ////////////////////////////////////////////
 void MemberSlot::SetMemberStats(Player* player)
@@ -225,6 +226,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
 
     CharacterDatabase.PExecute("INSERT INTO guild_member (guildid,guid,rank,pnote,offnote) VALUES ('%u', '%u', '%u','%s','%s')",
                                m_Id, lowguid, newmember.RankId, dbPnote.c_str(), dbOFFnote.c_str());
+    sCharacterEnumCache.InvalidateCharacter(plGuid);
 
     // If player not in game data in data field will be loaded from guild tables, no need to update it!!
     if (pl)
@@ -232,6 +234,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
         pl->SetInGuild(m_Id);
         pl->SetRank(newmember.RankId);
         pl->SetGuildIdInvited(0);
+        SetMemberOnline(pl);
     }
 
     UpdateAccountsNumber();
@@ -528,6 +531,7 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
     }
 
     members.erase(lowguid);
+    SetMemberOffline(guid);
 
     Player* player = sObjectMgr.GetPlayer(guid);
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
@@ -538,6 +542,7 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
     }
 
     CharacterDatabase.PExecute("DELETE FROM guild_member WHERE guid = '%u'", lowguid);
+    sCharacterEnumCache.InvalidateCharacter(guid);
 
     if (!isDisbanding)
         UpdateAccountsNumber();
@@ -545,6 +550,14 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
     return members.empty();
 }
 
+void Guild::SetMemberOnline(Player* player)
+{
+    if (members.find(player->GetGUIDLow()) == members.end())
+        return;
+
+    m_onlineMembers[player->GetGUIDLow()] = player;
+}
+
 void Guild::BroadcastToGuild(WorldSession* session, const std::string& msg, uint32 language)
 {
     if (!session)
@@ -557,11 +570,11 @@ void Guild::BroadcastToGuild(WorldSession* session, const std::string& msg, uint
     WorldPacket data;
     ChatHandler::BuildChatPacket(data, CHAT_MSG_GUILD, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (OnlineMemberList::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        Player* pl = itr->second;
 
-        if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
+        if (pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
             pl->GetSession()->SendPacket(&data);
     }
 }
@@ -575,38 +588,31 @@ void Guild::BroadcastToOfficers(WorldSession* session, const std::string& msg, u
     if (!player || !HasRankRight(player->GetRank(), GR_RIGHT_OFFCHATSPEAK))
         return;
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
-    {
-        WorldPacket data;
-        ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
+    WorldPacket data;
+    ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
 
-        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+    for (OnlineMemberList::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+    {
+        Player* pl = itr->second;
 
-        if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
+        if (pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
             pl->GetSession()->SendPacket(&data);
     }
 }
 
 void Guild::BroadcastPacket(WorldPacket* packet)
 {
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
-    {
-        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (player)
-            player->GetSession()->SendPacket(packet);
-    }
+    for (OnlineMemberList::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+        itr->second->GetSession()->SendPacket(packet);
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket* packet, uint32 rankId)
 {
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (OnlineMemberList::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        if (itr->second.RankId == rankId)
-        {
-            Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-            if (player)
-                player->GetSession()->SendPacket(packet);
-        }
+        MemberList::const_iterator mItr = members.find(itr->first);
+        if (mItr != members.end() && mItr->second.RankId == rankId)
+            itr->second->GetSession()->SendPacket(packet);
     }
 }
 
@@ -731,7 +737,7 @@ void Guild::Roster(WorldSession* session /*= NULL*/)
 	{
 		if (cont > conta)
 			break;
-		if (Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first)))
+		if (Player* pl = GetOnlineMember(itr->first))
 		{
 			data << pl->GetObjectGuid();
 			data << uint8(1);
@@ -749,7 +755,7 @@ void Guild::Roster(WorldSession* session /*= NULL*/)
 	{
 		if (cont > conta)
 			break;
-		if (Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first)))
+		if (Player* pl = GetOnlineMember(itr->first))
 		{
 			continue;
 		}
@@ -956,7 +962,7 @@ uint32 Guild::GuildMemberCont()
 	uint32 cont = 0;
 	for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
 	{
-		if (Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first)))
+		if (Player* pl = GetOnlineMember(itr->first))
 		{
 			if (pl->getLevel() == 60)
 				++cont;
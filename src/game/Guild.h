@@ -201,6 +201,7 @@ class Guild
         void Disband();
 
         typedef UNORDERED_MAP<uint32, MemberSlot> MemberList;
+        typedef UNORDERED_MAP<uint32, Player*> OnlineMemberList;
         typedef std::vector<RankInfo> RankList;
 
         uint32 GetId() { return m_Id; }
@@ -222,6 +223,15 @@ class Guild
         void SetLeader(ObjectGuid guid);
         bool AddMember(ObjectGuid plGuid, uint32 plRank);
         bool DelMember(ObjectGuid guid, bool isDisbanding = false);
+
+        // online members are tracked at login/logout so broadcasts not need lookup all members in global player map
+        void SetMemberOnline(Player* player);
+        void SetMemberOffline(ObjectGuid guid) { m_onlineMembers.erase(guid.GetCounter()); }
+        Player* GetOnlineMember(uint32 lowguid) const
+        {
+            OnlineMemberList::const_iterator itr = m_onlineMembers.find(lowguid);
+            return itr != m_onlineMembers.end() ? itr->second : NULL;
+        }
         // lowest rank is the count of ranks - 1 (the highest rank_id in table)
         uint32 GetLowestRank() const { return m_Ranks.size() - 1; }
 
@@ -251,10 +261,9 @@ class Guild
         template<class Do>
         void BroadcastWorker(Do& _do, Player* except = NULL)
         {
-            for (MemberList::iterator itr = members.begin(); itr != members.end(); ++itr)
-                if (Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first)))
-                    if (player != except)
-                        _do(player);
+            for (OnlineMemberList::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+                if (itr->second != except)
+                    _do(itr->second);
         }
 
         void CreateRank(std::string name, uint32 rights);
@@ -323,6 +332,7 @@ class Guild
         RankList m_Ranks;
 
         MemberList members;
+        OnlineMemberList m_onlineMembers;                   // subset of members currently logged in
 
         /** These are actually ordered lists. The first element is the oldest entry.*/
         typedef std::list<GuildEventLogEntry> GuildEventLog;
@@ -19,23 +19,110 @@
 #include "InstanceData.h"
 #include "Database/DatabaseEnv.h"
 #include "Map.h"
+#include "MapPersistentStateMgr.h"
 
-void InstanceData::SaveToDB() const
+// Saved values are stored in front of the script data as "#V1 key value ...|", data without the header is script data only
+#define INSTANCE_DATA_HEADER        "#V"
+#define INSTANCE_DATA_VERSION       1
+#define INSTANCE_DATA_END           '|'
+
+void InstanceData::FlushToDB()
 {
+    if (!m_saveRequested)
+        return;
+
+    m_saveRequested = false;
+
     // no reason to save BGs/Arenas
     if (instance->IsBattleGround())
         return;
 
-    if (!Save())
+    // nothing to save, keep the stored script data
+    if (m_savedValues.empty() && !Save())
         return;
 
-    std::string data = Save();
-    CharacterDatabase.escape_string(data);
+    std::string record = GetSaveRecord();
+    if (record == m_lastSavedRecord)
+        return;
+
+    m_lastSavedRecord = record;
+    sMapPersistentStateMgr.SetSavedInstanceData(instance->Instanceable(), instance->Instanceable() ? instance->GetInstanceId() : instance->GetId(), record);
+
+    CharacterDatabase.escape_string(record);
 
     if (instance->Instanceable())
-        CharacterDatabase.PExecute("UPDATE instance SET data = '%s' WHERE id = '%u'", data.c_str(), instance->GetInstanceId());
+        CharacterDatabase.PExecute("UPDATE instance SET data = '%s' WHERE id = '%u'", record.c_str(), instance->GetInstanceId());
     else
-        CharacterDatabase.PExecute("UPDATE world SET data = '%s' WHERE map = '%u'", data.c_str(), instance->GetId());
+        CharacterDatabase.PExecute("UPDATE world SET data = '%s' WHERE map = '%u'", record.c_str(), instance->GetId());
+}
+
+std::string InstanceData::GetSaveRecord() const
+{
+    std::ostringstream ss;
+
+    if (!m_savedValues.empty())
+    {
+        ss << INSTANCE_DATA_HEADER << INSTANCE_DATA_VERSION;
+        for (SavedValueMap::const_iterator itr = m_savedValues.begin(); itr != m_savedValues.end(); ++itr)
+            ss << ' ' << itr->first << ' ' << itr->second;
+        ss << INSTANCE_DATA_END;
+    }
+
+    if (const char* data = Save())
+        ss << data;
+
+    return ss.str();
+}
+
+void InstanceData::LoadFromDB(const char* data)
+{
+    m_lastSavedRecord = data;
+    m_savedValues.clear();
+
+    size_t headerLen = strlen(INSTANCE_DATA_HEADER);
+    if (strncmp(data, INSTANCE_DATA_HEADER, headerLen) == 0)
+    {
+        const char* end = strchr(data, INSTANCE_DATA_END);
+        if (!end)
+        {
+            sLog.outError("InstanceData::LoadFromDB: unterminated saved values for map %u instance %u, data ignored", instance->GetId(), instance->GetInstanceId());
+            return;
+        }
+
+        std::istringstream ss(std::string(data + headerLen, end));
+        uint32 version = 0;
+        ss >> version;
+
+        if (version == INSTANCE_DATA_VERSION)
+        {
+            uint32 key;
+            uint64 value;
+            while (ss >> key >> value)
+                m_savedValues[key] = value;
+        }
+        else
+            sLog.outError("InstanceData::LoadFromDB: unknown saved values version %u for map %u instance %u, values ignored", version, instance->GetId(), instance->GetInstanceId());
+
+        data = end + 1;
+    }
+
+    Load(data);
+}
+
+uint64 InstanceData::GetSavedValue64(uint32 key, uint64 defaultValue) const
+{
+    SavedValueMap::const_iterator itr = m_savedValues.find(key);
+    return itr != m_savedValues.end() ? itr->second : defaultValue;
+}
+
+void InstanceData::SetSavedValue64(uint32 key, uint64 value)
+{
+    SavedValueMap::iterator itr = m_savedValues.find(key);
+    if (itr != m_savedValues.end() && itr->second == value)
+        return;
+
+    m_savedValues[key] = value;
+    SaveToDB();
 }
 
 bool InstanceData::CheckConditionCriteriaMeet(Player const* /*source*/, uint32 instance_condition_id, WorldObject const* /*conditionSource*/, uint32 conditionSourceType) const
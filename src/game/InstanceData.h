@@ -47,7 +47,7 @@ class MANGOS_DLL_SPEC InstanceData
 {
     public:
 
-        explicit InstanceData(Map* map) : instance(map) {}
+        explicit InstanceData(Map* map) : instance(map), m_saveRequested(false) {}
         virtual ~InstanceData() {}
 
         Map* instance;
@@ -61,7 +61,21 @@ class MANGOS_DLL_SPEC InstanceData
         // When save is needed, this function generates the data
         virtual const char* Save() const { return ""; }
 
-        void SaveToDB() const;
+        // Request a save, the data is written once at the end of the map update and only if it changed
+        void SaveToDB() const { m_saveRequested = true; }
+        void FlushToDB();
+        // Drop a requested save, the stored data of the instance is being deleted
+        void DiscardSave() { m_saveRequested = false; }
+
+        // Stored `instance`/`world` data, the saved values followed by the Save() string
+        void LoadFromDB(const char* data);
+        std::string GetSaveRecord() const;
+
+        // Typed values saved with the instance, changes request a save
+        uint32 GetSavedValue(uint32 key, uint32 defaultValue = 0) const { return uint32(GetSavedValue64(key, defaultValue)); }
+        void SetSavedValue(uint32 key, uint32 value) { SetSavedValue64(key, value); }
+        uint64 GetSavedValue64(uint32 key, uint64 defaultValue = 0) const;
+        void SetSavedValue64(uint32 key, uint64 value);
 
         // Called every map update
         virtual void Update(uint32 /*diff*/) {}
@@ -112,6 +126,13 @@ class MANGOS_DLL_SPEC InstanceData
         // This is used for such things are heroic loot
         // See ObjectMgr.h enum ConditionSource for possible values of conditionSourceType
         virtual bool CheckConditionCriteriaMeet(Player const* source, uint32 instance_condition_id, WorldObject const* conditionSource, uint32 conditionSourceType) const;
+
+    private:
+        typedef std::map<uint32, uint64> SavedValueMap;
+        SavedValueMap m_savedValues;
+
+        mutable bool m_saveRequested;
+        std::string m_lastSavedRecord;                      // skip writes of unchanged data
 };
 
 #endif
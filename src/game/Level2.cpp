@@ -38,6 +38,7 @@
 #include "SpellMgr.h"
 #include "MapPersistentStateMgr.h"
 #include "AccountMgr.h"
+#include "CharacterEnumCache.h"
 #include "GMTicketMgr.h"
 #include "WaypointManager.h"
 #include "DBCStores.h"
@@ -3413,6 +3414,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
         PSendSysMessage(LANG_RENAME_PLAYER, GetNameLink(target).c_str());
         target->SetAtLoginFlag(AT_LOGIN_RENAME);
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '1' WHERE guid = '%u'", target->GetGUIDLow());
+        sCharacterEnumCache.InvalidateCharacter(target->GetObjectGuid());
     }
     else
     {
@@ -3424,6 +3426,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
 
         PSendSysMessage(LANG_RENAME_PLAYER_GUID, oldNameLink.c_str(), target_guid.GetCounter());
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '1' WHERE guid = '%u'", target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid);
     }
 
     return true;
@@ -4538,6 +4541,24 @@ bool ChatHandler::HandleServerCorpsesCommand(char* /*args*/)
     return true;
 }
 
+bool ChatHandler::HandleServerGridsCommand(char* /*args*/)
+{
+    GridMemoryUsage usage;
+    sMapMgr.GetGridMemoryUsage(usage);
+
+    PSendSysMessage("Loaded grids: %u (%u idle)", usage.grids, usage.idleGrids);
+    PSendSysMessage("Estimated memory: " UI64FMTD " KB (objects " UI64FMTD " KB, terrain " UI64FMTD " KB, vmaps " UI64FMTD " KB, mmaps " UI64FMTD " KB)",
+                    usage.GetTotal() / 1024, usage.objects / 1024, usage.terrain / 1024, usage.vmap / 1024, usage.mmap / 1024);
+    PSendSysMessage("Terrain waiting for cleanup: " UI64FMTD " KB", usage.unreferenced / 1024);
+
+    if (uint32 budget = sWorld.getConfig(CONFIG_UINT32_GRID_MEMORY_BUDGET))
+        PSendSysMessage("Memory budget: %u MB", budget);
+    else
+        SendSysMessage("Memory budget: disabled");
+
+    return true;
+}
+
 bool ChatHandler::HandleRepairitemsCommand(char* args)
 {
     Player* target;
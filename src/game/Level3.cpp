@@ -52,6 +52,7 @@
 #include "BattleGround/BattleGroundMgr.h"
 #include "MapPersistentStateMgr.h"
 #include "InstanceData.h"
+#include "CharacterEnumCache.h"
 #include "DBCStores.h"
 #include "CreatureEventAIMgr.h"
 #include "AuctionHouseBot/AuctionHouseBot.h"
@@ -465,6 +466,14 @@ bool ChatHandler::HandleReloadQuestTemplateCommand(char* /*args*/)
     sObjectMgr.LoadQuests();
 	PSendSysMessage("DB table `quest_template` (quest definitions) reloaded.");
 
+    // quest objective indexes of online players are built from the old templates
+    {
+        HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
+        HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
+        for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+            itr->second->RebuildQuestObjectiveIndex();
+    }
+
     /// dependent also from `gameobject` but this table not reloaded anyway
     sLog.outString("Re-Loading GameObjects for quests...");
     sObjectMgr.LoadGameObjectForQuests();
@@ -4545,6 +4554,7 @@ bool ChatHandler::HandleResetSpellsCommand(char* args)
     else
     {
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid = '%u'", uint32(AT_LOGIN_RESET_SPELLS), target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid);
         PSendSysMessage(LANG_RESET_SPELLS_OFFLINE, target_name.c_str());
     }
 
@@ -4572,6 +4582,7 @@ bool ChatHandler::HandleResetTalentsCommand(char* args)
     {
         uint32 at_flags = AT_LOGIN_RESET_TALENTS;
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid = '%u'", at_flags, target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid);
         std::string nameLink = playerLink(target_name);
         PSendSysMessage(LANG_RESET_TALENTS_OFFLINE, nameLink.c_str());
         return true;
@@ -4614,6 +4625,7 @@ bool ChatHandler::HandleResetAllCommand(char* args)
     }
 
     CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE (at_login & '%u') = '0'", atLogin, atLogin);
+    sCharacterEnumCache.InvalidateAll();
     HashMapHolder<Player>::MapType const& plist = sObjectAccessor.GetPlayers();
     for (HashMapHolder<Player>::MapType::const_iterator itr = plist.begin(); itr != plist.end(); ++itr)
         itr->second->SetAtLoginFlag(atLogin);
@@ -5484,42 +5496,54 @@ bool ChatHandler::HandlePDumpWriteCommand(char* args)
     if (!file)
         return false;
 
-    char* p2 = ExtractLiteralArg(&args);
-
-    uint32 lowguid;
-    ObjectGuid guid;
-    // character name can't start from number
-    if (!ExtractUInt32(&p2, lowguid))
+    // more than one character is written as bulk dump
+    std::vector<uint32> lowguids;
+    while (char* p2 = ExtractLiteralArg(&args))
     {
-        std::string name = ExtractPlayerNameFromLink(&p2);
-        if (name.empty())
+        uint32 lowguid;
+        ObjectGuid guid;
+        // character name can't start from number
+        if (!ExtractUInt32(&p2, lowguid))
         {
-            SendSysMessage(LANG_PLAYER_NOT_FOUND);
-            SetSentErrorMessage(true);
-            return false;
+            std::string name = ExtractPlayerNameFromLink(&p2);
+            if (name.empty())
+            {
+                SendSysMessage(LANG_PLAYER_NOT_FOUND);
+                SetSentErrorMessage(true);
+                return false;
+            }
+
+            guid = sObjectMgr.GetPlayerGuidByName(name);
+            if (!guid)
+            {
+                PSendSysMessage(LANG_PLAYER_NOT_FOUND);
+                SetSentErrorMessage(true);
+                return false;
+            }
+
+            lowguid = guid.GetCounter();
         }
+        else
+            guid = ObjectGuid(HIGHGUID_PLAYER, lowguid);
 
-        guid = sObjectMgr.GetPlayerGuidByName(name);
-        if (!guid)
+        if (!sObjectMgr.GetPlayerAccountIdByGUID(guid))
         {
             PSendSysMessage(LANG_PLAYER_NOT_FOUND);
             SetSentErrorMessage(true);
             return false;
         }
 
-        lowguid = guid.GetCounter();
+        lowguids.push_back(lowguid);
     }
-    else
-        guid = ObjectGuid(HIGHGUID_PLAYER, lowguid);
 
-    if (!sObjectMgr.GetPlayerAccountIdByGUID(guid))
+    if (lowguids.empty())
     {
-        PSendSysMessage(LANG_PLAYER_NOT_FOUND);
+        SendSysMessage(LANG_PLAYER_NOT_FOUND);
         SetSentErrorMessage(true);
         return false;
     }
 
-    switch (PlayerDumpWriter().WriteDump(file, lowguid))
+    switch (PlayerDumpWriter().WriteDump(file, lowguids))
     {
         case DUMP_SUCCESS:
             PSendSysMessage(LANG_COMMAND_EXPORT_SUCCESS);
@@ -5999,6 +6023,7 @@ bool ChatHandler::HandleInstanceSaveDataCommand(char* /*args*/)
     }
 
     iData->SaveToDB();
+    iData->FlushToDB();
     return true;
 }
 
@@ -8362,7 +8387,7 @@ bool ChatHandler::HandleAplRankCommand(char* args)
 	    while (result->NextRow());
 	    delete result;
 
-		AllPlayerList.sort();
+		std::stable_sort(AllPlayerList.begin(), AllPlayerList.end());
 		for (HonorStandingList::iterator itr = AllPlayerList.begin(); itr != AllPlayerList.end(); ++itr)
 		{
 			++cont;
@@ -8436,7 +8461,7 @@ bool ChatHandler::HandleAplWorldRankCommand(char* args)
 		while (result->NextRow());
 		delete result;
 
-		AllPlayerList.sort();
+		std::stable_sort(AllPlayerList.begin(), AllPlayerList.end());
 		for (HonorStandingList::iterator itr = AllPlayerList.begin(); itr != AllPlayerList.end(); ++itr)
 		{
 			++cont;
@@ -8510,7 +8535,7 @@ bool ChatHandler::HandleAplSelfCommand(char* args)
 		while (result->NextRow());
 		delete result;
 
-		AllPlayerList.sort();
+		std::stable_sort(AllPlayerList.begin(), AllPlayerList.end());
 		for (HonorStandingList::iterator itr = AllPlayerList.begin(); itr != AllPlayerList.end(); ++itr)
 		{
 			++cont;
@@ -36,8 +36,10 @@
 #include "VMapFactory.h"
 #include "MoveMap.h"
 #include "BattleGround/BattleGroundMgr.h"
+#include "OutdoorPvP/OutdoorPvPMgr.h"
 #include "Chat.h"
 #include "Weather.h"
+#include "movement/MoveSpline.h"
 
 Map::~Map()
 {
@@ -49,6 +51,9 @@ Map::~Map()
     if (m_persistentState)
         m_persistentState->SetUsedByMapState(NULL);         // field pointer can be deleted after this
 
+    if (i_data)
+        i_data->FlushToDB();
+
     delete i_data;
     i_data = NULL;
 
@@ -96,6 +101,8 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
     // lets initialize visibility distance for map
     Map::InitVisibilityDistance();
 
+    m_outdoorPvPUpdateTimer.SetInterval(TIMER_OPVP_MGR_UPDATE);
+
     // add reference for TerrainData object
     m_TerrainData->AddRef();
 
@@ -358,6 +365,7 @@ bool Map::Add(Player* player)
     NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
     player->GetViewPoint().Event_AddedToWorld(&(*grid)(cell.CellX(), cell.CellY()));
     UpdateObjectVisibility(player, cell, p);
+    NotifyTrapTriggers(player);
 
     if (i_data)
         i_data->OnPlayerEnter(player);
@@ -445,6 +453,66 @@ void Map::MessageBroadcast(WorldObject const* obj, WorldPacket* msg)
     cell.Visit(p, message, *this, *obj, GetVisibilityDistance());
 }
 
+// same as MessageBroadcast, but viewers receive the packet with their batched monster moves at the end of the update
+void Map::MonsterMoveBroadcast(WorldObject const* obj, WorldPacket* msg)
+{
+    CellPair p = MaNGOS::ComputeCellPair(obj->GetPositionX(), obj->GetPositionY());
+
+    if (p.x_coord >= TOTAL_NUMBER_OF_CELLS_PER_MAP || p.y_coord >= TOTAL_NUMBER_OF_CELLS_PER_MAP)
+    {
+        sLog.outError("Map::MonsterMoveBroadcast: Object (GUID: %u TypeId: %u) have invalid coordinates X:%f Y:%f grid cell [%u:%u]", obj->GetGUIDLow(), obj->GetTypeId(), obj->GetPositionX(), obj->GetPositionY(), p.x_coord, p.y_coord);
+        return;
+    }
+
+    Cell cell(p);
+    cell.SetNoCreate();
+
+    if (!loaded(GridPair(cell.data.Part.grid_x, cell.data.Part.grid_y)))
+        return;
+
+    MaNGOS::MonsterMoveDeliverer post_man(msg);
+    TypeContainerVisitor<MaNGOS::MonsterMoveDeliverer, WorldTypeMapContainer > message(post_man);
+    cell.Visit(p, message, *this, *obj, GetVisibilityDistance());
+}
+
+void Map::QueueSplinePosition(Creature* creature)
+{
+    m_splineBatch.Add(*creature->movespline);
+    m_splineBatchUnits.push_back(SplineBatchUnits::value_type(creature->GetObjectGuid(), creature->movespline->GetId()));
+}
+
+void Map::UpdateSplinePositions()
+{
+    if (m_splineBatchUnits.empty())
+        return;
+
+    m_splineBatch.Evaluate();
+
+    for (uint32 i = 0; i < m_splineBatchUnits.size(); ++i)
+    {
+        // the creature may have been removed or started another spline after it was queued
+        Creature* creature = GetAnyTypeCreature(m_splineBatchUnits[i].first);
+        if (!creature || !creature->IsInWorld() || creature->movespline->GetId() != m_splineBatchUnits[i].second)
+            continue;
+
+        G3D::Vector3 c;
+        float orientation;
+        m_splineBatch.GetResult(i, c, orientation);
+        Movement::Location loc = creature->movespline->ComputePosition(c, orientation);
+        CreatureRelocation(creature, loc.x, loc.y, loc.z, loc.orientation);
+    }
+
+    m_splineBatch.Clear();
+    m_splineBatchUnits.clear();
+}
+
+void Map::SendQueuedMonsterMoves()
+{
+    for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+        if (WorldSession* session = itr->getSource()->GetSession())
+            session->SendQueuedMonsterMoves();
+}
+
 void Map::MessageDistBroadcast(Player const* player, WorldPacket* msg, float dist, bool to_self, bool own_team_only)
 {
     CellPair p = MaNGOS::ComputeCellPair(player->GetPositionX(), player->GetPositionY());
@@ -600,6 +668,16 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
+    // transports located at this map, moving to other map is finished by MapManager after all maps are updated
+    for (TransportSet::const_iterator itr = m_transports.begin(); itr != m_transports.end(); ++itr)
+    {
+        WorldObject::UpdateHelper helper(*itr);
+        helper.Update(t_diff);
+    }
+
+    // relocate creatures moved by splines in this update, before their updates are sent
+    UpdateSplinePositions();
+
     // Send world objects and item update field changes
     SendObjectUpdates();
 
@@ -624,11 +702,30 @@ void Map::Update(const uint32& t_diff)
     if (i_data)
         i_data->Update(t_diff);
 
+    // outdoor pvp scripts located at this map
+    m_outdoorPvPUpdateTimer.Update(t_diff);
+    if (m_outdoorPvPUpdateTimer.Passed())
+    {
+        sOutdoorPvPMgr.UpdateMap(this, m_outdoorPvPUpdateTimer.GetCurrent());
+        m_outdoorPvPUpdateTimer.Reset();
+    }
+
     m_weatherSystem->UpdateWeathers(t_diff);
+
+    // monster moves of this update, after SendObjectUpdates so new creatures are known to the client
+    SendQueuedMonsterMoves();
+
+    // write instance data saves requested during this update at once
+    if (i_data)
+        i_data->FlushToDB();
 }
 
 void Map::Remove(Player* player, bool remove)
 {
+    // moves of this map must not arrive after the player left it
+    if (WorldSession* session = player->GetSession())
+        session->SendQueuedMonsterMoves();
+
     if (i_data)
         i_data->OnPlayerLeave(player);
 
@@ -734,6 +831,7 @@ Map::PlayerRelocation(Player* player, float x, float y, float z, float orientati
     bool same_cell = (new_cell == old_cell);
 
     player->Relocate(x, y, z, orientation);
+    NotifyTrapTriggers(player);
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
@@ -772,6 +870,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
         // update pos
         creature->Relocate(x, y, z, ang);
         creature->OnRelocated();
+        NotifyTrapTriggers(creature);
     }
     // if creature can't be move in new cell/grid (not loaded) move it to repawn cell/grid
     // creature coordinates will be updated and notifiers send
@@ -876,6 +975,44 @@ bool Map::UnloadGrid(const uint32& x, const uint32& y, bool pForce)
     return true;
 }
 
+static uint32 GetGridObjectsMemoryUsage(NGridType const& grid)
+{
+    // rough estimate, dynamic containers owned by the objects are not accounted
+    return grid.GridObjectsCount<Creature>() * sizeof(Creature) +
+           grid.GridObjectsCount<GameObject>() * sizeof(GameObject) +
+           grid.GridObjectsCount<DynamicObject>() * sizeof(DynamicObject) +
+           grid.GridObjectsCount<Corpse>() * sizeof(Corpse);
+}
+
+void Map::GetGridMemoryUsage(GridMemoryUsage& usage)
+{
+    for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end(); ++i)
+    {
+        NGridType const* grid = i->getSource();
+        ++usage.grids;
+        if (grid->GetGridState() == GRID_STATE_REMOVAL)
+            ++usage.idleGrids;
+
+        usage.objects += GetGridObjectsMemoryUsage(*grid);
+    }
+}
+
+uint32 Map::GetGridMemoryUsage(uint32 x, uint32 y) const
+{
+    NGridType const* grid = getNGrid(x, y);
+    if (!grid)
+        return 0;
+
+    uint32 usage = GetGridObjectsMemoryUsage(*grid);
+
+    int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
+    int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
+    if (m_bLoadedGrids[gx][gy])
+        usage += m_TerrainData->GetGridMemoryUsage(gx, gy);
+
+    return usage;
+}
+
 void Map::UnloadAll(bool pForce)
 {
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
@@ -1224,30 +1361,21 @@ void Map::CreateInstanceData(bool load)
 
     if (load)
     {
-        // TODO: make a global storage for this
-        QueryResult* result;
-
-        if (Instanceable())
-            result = CharacterDatabase.PQuery("SELECT data FROM instance WHERE id = '%u'", i_InstanceId);
-        else
-            result = CharacterDatabase.PQuery("SELECT data FROM world WHERE map = '%u'", GetId());
-
-        if (result)
+        // stored data of all instances is loaded at server startup
+        std::string data;
+        if (sMapPersistentStateMgr.GetSavedInstanceData(Instanceable(), Instanceable() ? i_InstanceId : GetId(), data))
         {
-            Field* fields = result->Fetch();
-            const char* data = fields[0].GetString();
-            if (data)
-            {
-                DEBUG_LOG("Loading instance data for `%s` (Map: %u Instance: %u)", sScriptMgr.GetScriptName(i_script_id), GetId(), i_InstanceId);
-                i_data->Load(data);
-            }
-            delete result;
+            DEBUG_LOG("Loading instance data for `%s` (Map: %u Instance: %u)", sScriptMgr.GetScriptName(i_script_id), GetId(), i_InstanceId);
+            i_data->LoadFromDB(data.c_str());
         }
         else
         {
             // for non-instanceable map always add data to table if not found, later code expected that for map in `word` exist always after load
             if (!Instanceable())
+            {
                 CharacterDatabase.PExecute("INSERT INTO world VALUES ('%u', '')", GetId());
+                sMapPersistentStateMgr.SetSavedInstanceData(false, GetId(), data);
+            }
         }
     }
     else
@@ -1538,8 +1666,14 @@ void DungeonMap::UnloadAll(bool pForce)
     TeleportAllPlayersTo(TELEPORT_LOCATION_HOMEBIND);
 
     if (m_resetAfterUnload == true)
+    {
         GetPersistanceState()->DeleteRespawnTimes();
 
+        // the instance is reset, do not write its data back when the map is deleted
+        if (InstanceData* iData = GetInstanceData())
+            iData->DiscardSave();
+    }
+
     Map::UnloadAll(pForce);
 }
 
@@ -2123,6 +2257,64 @@ float Map::GetHeight(float x, float y, float z) const
     return std::max<float>(staticHeight, m_dyn_tree.getHeight(x, y, dynSearchHeight, dynSearchHeight - staticHeight));
 }
 
+static void GetTrapTriggerCells(GameObject* go, CellPair& low, CellPair& high)
+{
+    float radius = go->GetTrapTriggerRadius();
+    CellPair p1 = MaNGOS::ComputeCellPair(go->GetPositionX() - radius, go->GetPositionY() - radius).normalize();
+    CellPair p2 = MaNGOS::ComputeCellPair(go->GetPositionX() + radius, go->GetPositionY() + radius).normalize();
+
+    low = CellPair(std::min(p1.x_coord, p2.x_coord), std::min(p1.y_coord, p2.y_coord));
+    high = CellPair(std::max(p1.x_coord, p2.x_coord), std::max(p1.y_coord, p2.y_coord));
+}
+
+void Map::AddTrapTrigger(GameObject* go)
+{
+    CellPair low, high;
+    GetTrapTriggerCells(go, low, high);
+
+    for (uint32 x = low.x_coord; x <= high.x_coord; ++x)
+        for (uint32 y = low.y_coord; y <= high.y_coord; ++y)
+            m_trapTriggers[x * TOTAL_NUMBER_OF_CELLS_PER_MAP + y].push_back(go);
+}
+
+void Map::RemoveTrapTrigger(GameObject* go)
+{
+    CellPair low, high;
+    GetTrapTriggerCells(go, low, high);
+
+    for (uint32 x = low.x_coord; x <= high.x_coord; ++x)
+    {
+        for (uint32 y = low.y_coord; y <= high.y_coord; ++y)
+        {
+            TrapTriggerCellMap::iterator itr = m_trapTriggers.find(x * TOTAL_NUMBER_OF_CELLS_PER_MAP + y);
+            if (itr == m_trapTriggers.end())
+                continue;
+
+            TrapTriggerList& traps = itr->second;
+            traps.erase(std::remove(traps.begin(), traps.end(), go), traps.end());
+            if (traps.empty())
+                m_trapTriggers.erase(itr);
+        }
+    }
+}
+
+void Map::NotifyTrapTriggers(Unit* unit)
+{
+    if (m_trapTriggers.empty())
+        return;
+
+    CellPair p = MaNGOS::ComputeCellPair(unit->GetPositionX(), unit->GetPositionY());
+    TrapTriggerCellMap::const_iterator itr = m_trapTriggers.find(p.x_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP + p.y_coord);
+    if (itr == m_trapTriggers.end())
+        return;
+
+    for (TrapTriggerList::const_iterator tItr = itr->second.begin(); tItr != itr->second.end(); ++tItr)
+    {
+        if ((*tItr)->IsWithinDistInMap(unit, (*tItr)->GetTrapTriggerRadius()))
+            (*tItr)->SetTrapTriggerPending();
+    }
+}
+
 void Map::InsertGameObjectModel(const GameObjectModel& mdl)
 {
     m_dyn_tree.insert(mdl);
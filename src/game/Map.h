@@ -38,6 +38,7 @@
 #include "ScriptMgr.h"
 #include "CreatureLinkingMgr.h"
 #include "vmap/DynamicTree.h"
+#include "movement/MoveSplineBatch.h"
 
 #include <bitset>
 #include <list>
@@ -57,6 +58,7 @@ class BattleGround;
 class GridMap;
 class GameObjectModel;
 class WeatherSystem;
+class Transport;
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push,N), also any gcc version not support it at some platform
 #if defined( __GNUC__ )
@@ -126,6 +128,7 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
 
         void MessageBroadcast(Player const*, WorldPacket*, bool to_self);
         void MessageBroadcast(WorldObject const*, WorldPacket*);
+        void MonsterMoveBroadcast(WorldObject const*, WorldPacket*);
         void MessageDistBroadcast(Player const*, WorldPacket*, float dist, bool to_self, bool own_team_only = false);
         void MessageDistBroadcast(WorldObject const*, WorldPacket*, float dist);
 
@@ -164,6 +167,11 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         time_t GetGridExpiry(void) const { return i_gridExpiry; }
         uint32 GetId(void) const { return i_id; }
 
+        // estimated memory of the objects in the loaded grids, terrain is accounted by TerrainManager
+        void GetGridMemoryUsage(GridMemoryUsage& usage);
+        // estimated memory freed by unloading the grid
+        uint32 GetGridMemoryUsage(uint32 x, uint32 y) const;
+
         // some calls like isInWater should not use vmaps due to processor power
         // can return INVALID_HEIGHT if under z+2 z coord not found height
 
@@ -223,6 +231,19 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         // must called with RemoveFromWorld
         void RemoveFromActive(WorldObject* obj);
 
+        // transports currently located at map, updated in map update; changed only while maps are not updated
+        void AddTransport(Transport* transport) { m_transports.insert(transport); }
+        void RemoveTransport(Transport* transport) { m_transports.erase(transport); }
+
+        // traps activated by units in range, registered in all cells their radius covers; must called with AddToWorld/RemoveFromWorld
+        void AddTrapTrigger(GameObject* go);
+        void RemoveTrapTrigger(GameObject* go);
+        // wake up the traps having the unit in range, called when units move
+        void NotifyTrapTriggers(Unit* unit);
+
+        // spline position of a moving creature, evaluated with all others queued in this update and relocated after the grid visits
+        void QueueSplinePosition(Creature* creature);
+
         Player* GetPlayer(ObjectGuid guid);
         Creature* GetCreature(ObjectGuid guid);
         Pet* GetPet(ObjectGuid guid);
@@ -333,6 +354,8 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         void ScriptsProcess();
 
         void SendObjectUpdates();
+        void SendQueuedMonsterMoves();
+        void UpdateSplinePositions();
         std::set<Object*> i_objectsToClientUpdate;
 
     protected:
@@ -349,6 +372,19 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         typedef std::set<WorldObject*> ActiveNonPlayers;
         ActiveNonPlayers m_activeNonPlayers;
         ActiveNonPlayers::iterator m_activeNonPlayersIter;
+
+        typedef std::set<Transport*> TransportSet;
+        TransportSet m_transports;
+
+        typedef std::vector<GameObject*> TrapTriggerList;
+        typedef UNORDERED_MAP<uint32, TrapTriggerList> TrapTriggerCellMap;
+        TrapTriggerCellMap m_trapTriggers;                  // cell id -> traps with radius in the cell
+
+        Movement::MoveSplineBatch m_splineBatch;
+        typedef std::vector<std::pair<ObjectGuid, uint32> > SplineBatchUnits;
+        SplineBatchUnits m_splineBatchUnits;                // creature and its spline id per batch entry
+
+        ShortIntervalTimer m_outdoorPvPUpdateTimer;
         MapStoredObjectTypesContainer m_objectsStore;
 
     private:
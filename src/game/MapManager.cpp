@@ -28,6 +28,9 @@
 #include "Corpse.h"
 #include "ObjectMgr.h"
 
+// how often the grid memory budget is checked (in milliseconds)
+#define GRID_MEMORY_CHECK_INTERVAL (10 * IN_MILLISECONDS)
+
 #define CLASS_LOCK MaNGOS::ClassLevelLockable<MapManager, ACE_Recursive_Thread_Mutex>
 INSTANTIATE_SINGLETON_2(MapManager, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(MapManager, ACE_Recursive_Thread_Mutex);
@@ -36,6 +39,7 @@ MapManager::MapManager()
     : i_gridCleanUpDelay(sWorld.getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN))
 {
     i_timer.SetInterval(sWorld.getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
+    i_gridMemoryTimer.SetInterval(GRID_MEMORY_CHECK_INTERVAL);
 }
 
 MapManager::~MapManager()
@@ -212,10 +216,15 @@ void MapManager::Update(uint32 diff)
 
     }
 
-    for (TransportSet::iterator iter = m_Transports.begin(); iter != m_Transports.end(); ++iter)
+    // transports are updated by their current maps, here only moves between maps are finished
+    ProcessTransportTransfers();
+
+    // no map is updating now, so grids of any map can be unloaded
+    i_gridMemoryTimer.Update(i_timer.GetCurrent());
+    if (i_gridMemoryTimer.Passed())
     {
-        WorldObject::UpdateHelper helper((*iter));
-        helper.Update((uint32)i_timer.GetCurrent());
+        UnloadGridsOverMemoryBudget();
+        i_gridMemoryTimer.SetCurrent(0);
     }
 
     // remove all maps which can be unloaded
@@ -238,6 +247,88 @@ void MapManager::Update(uint32 diff)
     i_timer.SetCurrent(0);
 }
 
+struct GridUnloadCandidate
+{
+    GridUnloadCandidate(Map* _map, NGridType* _grid) : map(_map), x(_grid->getX()), y(_grid->getY()), lastActiveTime(_grid->GetLastActiveTime()) {}
+
+    bool operator<(GridUnloadCandidate const& other) const { return lastActiveTime < other.lastActiveTime; }
+
+    Map* map;
+    uint32 x;
+    uint32 y;
+    time_t lastActiveTime;
+};
+
+void MapManager::GetGridMemoryUsage(GridMemoryUsage& usage)
+{
+    for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+        iter->second->GetGridMemoryUsage(usage);
+
+    sTerrainMgr.GetMemoryUsage(usage);
+}
+
+void MapManager::UnloadGridsOverMemoryBudget()
+{
+    uint64 budget = uint64(sWorld.getConfig(CONFIG_UINT32_GRID_MEMORY_BUDGET)) * 1024 * 1024;
+    if (!budget)
+        return;
+
+    GridMemoryUsage usage;
+    GetGridMemoryUsage(usage);
+
+    uint64 total = usage.GetTotal();
+    if (total <= budget)
+        return;
+
+    std::vector<GridUnloadCandidate> candidates;
+    candidates.reserve(usage.idleGrids);
+    for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+    {
+        Map* map = iter->second;
+        for (GridRefManager<NGridType>::iterator i = map->GridRefManager<NGridType>::begin(); i != map->GridRefManager<NGridType>::end(); ++i)
+        {
+            NGridType* grid = i->getSource();
+            if (grid->GetGridState() == GRID_STATE_REMOVAL && !grid->getUnloadLock())
+                candidates.push_back(GridUnloadCandidate(map, grid));
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    uint32 unloaded = 0;
+    for (std::vector<GridUnloadCandidate>::const_iterator itr = candidates.begin(); itr != candidates.end() && total > budget; ++itr)
+    {
+        uint32 freed = itr->map->GetGridMemoryUsage(itr->x, itr->y);
+        if (!itr->map->UnloadGrid(itr->x, itr->y, false))
+            continue;
+
+        total = total > freed ? total - freed : 0;
+        ++unloaded;
+    }
+
+    DETAIL_LOG("MapManager: grid memory " UI64FMTD " KB over budget " UI64FMTD " KB, unloaded %u of %u idle grids",
+               usage.GetTotal() / 1024, budget / 1024, unloaded, uint32(candidates.size()));
+}
+
+void MapManager::ScheduleTransportTransfer(Transport* transport)
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(m_transportTransfersLock);
+    m_transportTransfers.insert(transport);
+}
+
+void MapManager::ProcessTransportTransfers()
+{
+    // no map is updated at this point, so passengers and both maps can be changed safely
+    TransportSet transfers;
+    {
+        ACE_Guard<ACE_Thread_Mutex> guard(m_transportTransfersLock);
+        transfers.swap(m_transportTransfers);
+    }
+
+    for (TransportSet::const_iterator itr = transfers.begin(); itr != transfers.end(); ++itr)
+        (*itr)->FinishMapTransfer();
+}
+
 void MapManager::RemoveAllObjectsInRemoveList()
 {
     for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end(); ++iter)
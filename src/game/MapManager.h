@@ -139,10 +139,16 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         typedef std::map<uint32, TransportSet> TransportMap;
         TransportMap m_TransportsByMap;
 
+        // called from map update thread, transport is moved to its new map after all maps are updated
+        void ScheduleTransportTransfer(Transport* transport);
+
         uint32 GenerateInstanceId() { return ++i_MaxInstanceId; }
         void InitMaxInstanceId();
         void InitializeVisibilityDistanceInfo();
 
+        // estimated memory of all loaded grids
+        void GetGridMemoryUsage(GridMemoryUsage& usage);
+
         /* statistics */
         uint32 GetNumInstances();
         uint32 GetNumPlayersInInstances();
@@ -177,6 +183,9 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         DungeonMap* CreateDungeonMap(uint32 id, uint32 InstanceId, DungeonPersistentState* save = NULL);
         BattleGroundMap* CreateBattleGroundMap(uint32 id, uint32 InstanceId, BattleGround* bg);
 
+        void ProcessTransportTransfers();
+        void UnloadGridsOverMemoryBudget();
+
         uint32 i_gridCleanUpDelay;
         MapMapType i_maps;
 		MapUpdater m_updater;
@@ -190,6 +199,10 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         uint32 m_tickCount; 
  
         ShortIntervalTimer i_timer;
+        ShortIntervalTimer i_gridMemoryTimer;
+
+        TransportSet m_transportTransfers;                  // transports waiting for move to other map
+        ACE_Thread_Mutex m_transportTransfersLock;
 };
 
 template<typename Do>
@@ -253,13 +253,13 @@ void DungeonPersistentState::SaveToDB()
     if (Map* map = GetMap())
     {
         InstanceData* iData = map->GetInstanceData();
-        if (iData && iData->Save())
-        {
-            data = iData->Save();
-            CharacterDatabase.escape_string(data);
-        }
+        if (iData)
+            data = iData->GetSaveRecord();
     }
 
+    sMapPersistentStateMgr.SetSavedInstanceData(true, GetInstanceId(), data);
+    CharacterDatabase.escape_string(data);
+
     CharacterDatabase.PExecute("INSERT INTO instance VALUES ('%u', '%u', '" UI64FMTD "', '%s')", GetInstanceId(), GetMapId(), (uint64)GetResetTimeForDB(), data.c_str());
 }
 
@@ -275,6 +275,11 @@ void DungeonPersistentState::DeleteRespawnTimes()
 
 void DungeonPersistentState::DeleteFromDB()
 {
+    // a pending save of the loaded map would insert the deleted data again
+    if (Map* map = GetMap())
+        if (InstanceData* iData = map->GetInstanceData())
+            iData->DiscardSave();
+
     MapPersistentStateManager::DeleteInstanceFromDB(GetInstanceId());
 	if (GetMapId() == 309 || GetMapId() == 409 || GetMapId() == 469 || GetMapId() == 249)
 	    sLog.outBug("DungeonPersistentState::DeleteFromDB() = %u GetMapId = %u", GetInstanceId(), GetMapId());
@@ -720,6 +725,8 @@ void MapPersistentStateManager::DeleteInstanceFromDB(uint32 instanceid)
 			if (map == 309 || map == 409 || map == 469 || map == 249)
 			    sLog.outBug("MapPersistentStateManager::DeleteInstanceFromDB = %u map = %u", instanceid, map);
 		}
+        sMapPersistentStateMgr.RemoveSavedInstanceData(instanceid);
+
         CharacterDatabase.BeginTransaction();
         CharacterDatabase.PExecute("DELETE FROM instance WHERE id = '%u'", instanceid);
         CharacterDatabase.PExecute("DELETE FROM character_instance WHERE instance = '%u'", instanceid);
@@ -875,6 +882,68 @@ void MapPersistentStateManager::PackInstances()
     sLog.outString();
 }
 
+void MapPersistentStateManager::LoadSavedInstanceData()
+{
+    m_savedInstanceData.clear();
+    m_savedWorldData.clear();
+
+    //                                                    0   1
+    QueryResult* result = CharacterDatabase.Query("SELECT id, data FROM instance");
+    if (result)
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            m_savedInstanceData[fields[0].GetUInt32()] = fields[1].GetCppString();
+        }
+        while (result->NextRow());
+        delete result;
+    }
+
+    //                                       0    1
+    result = CharacterDatabase.Query("SELECT map, data FROM world");
+    if (result)
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            m_savedWorldData[fields[0].GetUInt32()] = fields[1].GetCppString();
+        }
+        while (result->NextRow());
+        delete result;
+    }
+
+    sLog.outString(">> Loaded instance data for " SIZEFMTD " instances and " SIZEFMTD " maps", m_savedInstanceData.size(), m_savedWorldData.size());
+    sLog.outString();
+}
+
+bool MapPersistentStateManager::GetSavedInstanceData(bool instanceable, uint32 id, std::string& data) const
+{
+    Guard guard(m_savedInstanceDataLock);
+
+    SavedInstanceDataMap const& dataMap = instanceable ? m_savedInstanceData : m_savedWorldData;
+    SavedInstanceDataMap::const_iterator itr = dataMap.find(id);
+    if (itr == dataMap.end())
+        return false;
+
+    data = itr->second;
+    return true;
+}
+
+void MapPersistentStateManager::SetSavedInstanceData(bool instanceable, uint32 id, std::string const& data)
+{
+    Guard guard(m_savedInstanceDataLock);
+
+    (instanceable ? m_savedInstanceData : m_savedWorldData)[id] = data;
+}
+
+void MapPersistentStateManager::RemoveSavedInstanceData(uint32 instanceId)
+{
+    Guard guard(m_savedInstanceDataLock);
+
+    m_savedInstanceData.erase(instanceId);
+}
+
 void MapPersistentStateManager::_ResetSave(PersistentStateMap& holder, PersistentStateMap::iterator& itr)
 {
     // unbind all players bound to the instance
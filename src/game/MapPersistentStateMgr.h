@@ -23,6 +23,7 @@
 #include "Platform/Define.h"
 #include "Policies/Singleton.h"
 #include "ace/Thread_Mutex.h"
+#include "ace/Guard_T.h"
 #include <list>
 #include <map>
 #include "Utilities/UnorderedMapSet.h"
@@ -351,6 +352,12 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
 
         static void DeleteInstanceFromDB(uint32 instanceid);
 
+        // `instance`.`data` and `world`.`data` kept in memory, instanceable maps are stored by instance id, others by map id
+        void LoadSavedInstanceData();
+        bool GetSavedInstanceData(bool instanceable, uint32 id, std::string& data) const;
+        void SetSavedInstanceData(bool instanceable, uint32 id, std::string const& data);
+        void RemoveSavedInstanceData(uint32 instanceId);
+
         void GetStatistics(uint32& numStates, uint32& numBoundPlayers, uint32& numBoundGroups);
 
         void Update() { m_Scheduler.Update(); }
@@ -373,6 +380,13 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
         PersistentStateMap m_instanceSaveByMapId;
 
         DungeonResetScheduler m_Scheduler;
+
+        typedef UNORDERED_MAP<uint32 /*InstanceId or MapId*/, std::string> SavedInstanceDataMap;
+        SavedInstanceDataMap m_savedInstanceData;
+        SavedInstanceDataMap m_savedWorldData;
+        typedef ACE_Thread_Mutex LockType;
+        typedef ACE_Guard<LockType> Guard;
+        mutable LockType m_savedInstanceDataLock;           // maps load and save their data from map update threads
 };
 
 template<typename Do>
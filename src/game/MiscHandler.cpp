@@ -36,6 +36,7 @@
 #include "ScriptMgr.h"
 #include <zlib/zlib.h>
 #include "ObjectAccessor.h"
+#include "WhoListCache.h"
 #include "Object.h"
 #include "BattleGround/BattleGround.h"
 #include "OutdoorPvP/OutdoorPvP.h"
@@ -74,186 +75,75 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recv_data)
     DEBUG_LOG("WORLD: Received opcode CMSG_WHO");
     // recv_data.hexlike();
 
-    uint32 level_min, level_max, racemask, classmask, zones_count, str_count;
-    uint32 zoneids[10];                                     // 10 is client limit
+    WhoListQuery query;
     std::string player_name, guild_name;
 
-    recv_data >> level_min;                                 // maximal player level, default 0
-    recv_data >> level_max;                                 // minimal player level, default 100 (MAX_LEVEL)
+    recv_data >> query.levelMin;                            // maximal player level, default 0
+    recv_data >> query.levelMax;                            // minimal player level, default 100 (MAX_LEVEL)
     recv_data >> player_name;                               // player name, case sensitive...
 
     recv_data >> guild_name;                                // guild name, case sensitive...
 
-    recv_data >> racemask;                                  // race mask
-    recv_data >> classmask;                                 // class mask
-    recv_data >> zones_count;                               // zones count, client limit=10 (2.0.10)
+    recv_data >> query.raceMask;                            // race mask
+    recv_data >> query.classMask;                           // class mask
+    recv_data >> query.zonesCount;                          // zones count, client limit=10 (2.0.10)
 
-    if (zones_count > 10)
+    if (query.zonesCount > 10)
         return;                                             // can't be received from real client or broken packet
 
-    for (uint32 i = 0; i < zones_count; ++i)
+    for (uint32 i = 0; i < query.zonesCount; ++i)
     {
-        uint32 temp;
-        recv_data >> temp;                                  // zone id, 0 if zone is unknown...
-        zoneids[i] = temp;
-        DEBUG_LOG("Zone %u: %u", i, zoneids[i]);
+        recv_data >> query.zoneIds[i];                      // zone id, 0 if zone is unknown...
+        DEBUG_LOG("Zone %u: %u", i, query.zoneIds[i]);
     }
 
-    recv_data >> str_count;                                 // user entered strings count, client limit=4 (checked on 2.0.10)
+    recv_data >> query.strCount;                            // user entered strings count, client limit=4 (checked on 2.0.10)
 
-    if (str_count > 4)
+    if (query.strCount > 4)
         return;                                             // can't be received from real client or broken packet
 
-    DEBUG_LOG("Minlvl %u, maxlvl %u, name %s, guild %s, racemask %u, classmask %u, zones %u, strings %u", level_min, level_max, player_name.c_str(), guild_name.c_str(), racemask, classmask, zones_count, str_count);
+    DEBUG_LOG("Minlvl %u, maxlvl %u, name %s, guild %s, racemask %u, classmask %u, zones %u, strings %u", query.levelMin, query.levelMax, player_name.c_str(), guild_name.c_str(), query.raceMask, query.classMask, query.zonesCount, query.strCount);
 
-    std::wstring str[4];                                    // 4 is client limit
-    for (uint32 i = 0; i < str_count; ++i)
+    for (uint32 i = 0; i < query.strCount; ++i)
     {
         std::string temp;
         recv_data >> temp;                                  // user entered string, it used as universal search pattern(guild+player name)?
 
-        if (!Utf8toWStr(temp, str[i]))
+        if (!Utf8toWStr(temp, query.strings[i]))
             continue;
 
-        wstrToLower(str[i]);
+        wstrToLower(query.strings[i]);
 
         DEBUG_LOG("String %u: %s", i, temp.c_str());
     }
 
-    std::wstring wplayer_name;
-    std::wstring wguild_name;
-    if (!(Utf8toWStr(player_name, wplayer_name) && Utf8toWStr(guild_name, wguild_name)))
+    if (!(Utf8toWStr(player_name, query.playerName) && Utf8toWStr(guild_name, query.guildName)))
         return;
-    wstrToLower(wplayer_name);
-    wstrToLower(wguild_name);
+    wstrToLower(query.playerName);
+    wstrToLower(query.guildName);
 
     // client send in case not set max level value 100 but mangos support 255 max level,
     // update it to show GMs with characters after 100 level
-    if (level_max >= MAX_LEVEL)
-        level_max = STRONG_MAX_LEVEL;
+    if (query.levelMax >= MAX_LEVEL)
+        query.levelMax = STRONG_MAX_LEVEL;
 
-    Team team = _player->GetTeam();
-    AccountTypes security = GetSecurity();
-    bool allowTwoSideWhoList = sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST);
-    AccountTypes gmLevelInWhoList = (AccountTypes)sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_IN_WHO_LIST);
+    query.viewerGuid = _player->GetObjectGuid();
+    query.security = GetSecurity();
+    query.gmLevelInWhoList = (AccountTypes)sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_IN_WHO_LIST);
+    query.locale = GetSessionDbcLocale();
+
+    // player can see member of other team only if CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST
+    if (query.security == SEC_PLAYER && !sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST))
+        query.team = _player->GetTeam();
 
-    uint32 matchcount = 0;
     uint32 displaycount = 0;
 
     WorldPacket data(SMSG_WHO, 50);                         // guess size
-    data << uint32(matchcount);                             // placeholder, count of players matching criteria
-    data << uint32(displaycount);                           // placeholder, count of players displayed
-
-    // TODO: Guard Player map
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
-    {
-        Player* pl = itr->second;
-
-        if (security == SEC_PLAYER)
-        {
-            // player can see member of other team only if CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST
-            if (pl->GetTeam() != team && !allowTwoSideWhoList)
-                continue;
-
-            // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
-            if (pl->GetSession()->GetSecurity() > gmLevelInWhoList)
-                continue;
-        }
-
-        // do not process players which are not in world
-        if (!pl->IsInWorld())
-            continue;
-
-        // check if target is globally visible for player
-        if (!pl->IsVisibleGloballyFor(_player))
-            continue;
-
-        // check if target's level is in level range
-        uint32 lvl = pl->getLevel();
-        if (lvl < level_min || lvl > level_max)
-            continue;
-
-        // check if class matches classmask
-        uint32 class_ = pl->getClass();
-        if (!(classmask & (1 << class_)))
-            continue;
-
-        // check if race matches racemask
-        uint32 race = pl->getRace();
-        if (!(racemask & (1 << race)))
-            continue;
-
-        uint32 pzoneid = pl->GetZoneId();
-
-        bool z_show = true;
-        for (uint32 i = 0; i < zones_count; ++i)
-        {
-            if (zoneids[i] == pzoneid)
-            {
-                z_show = true;
-                break;
-            }
+    data << uint32(0);                                      // placeholder, count of players displayed
+    data << uint32(0);                                      // placeholder, count of players matching criteria
 
-            z_show = false;
-        }
-        if (!z_show)
-            continue;
-
-        std::string pname = pl->GetName();
-        std::wstring wpname;
-        if (!Utf8toWStr(pname, wpname))
-            continue;
-        wstrToLower(wpname);
-
-        if (!(wplayer_name.empty() || wpname.find(wplayer_name) != std::wstring::npos))
-            continue;
-
-        std::string gname = sGuildMgr.GetGuildNameById(pl->GetGuildId());
-        std::wstring wgname;
-        if (!Utf8toWStr(gname, wgname))
-            continue;
-        wstrToLower(wgname);
-
-        if (!(wguild_name.empty() || wgname.find(wguild_name) != std::wstring::npos))
-            continue;
-
-        std::string aname;
-        if (AreaTableEntry const* areaEntry = GetAreaEntryByAreaID(pzoneid))
-            aname = areaEntry->area_name[GetSessionDbcLocale()];
-
-        bool s_show = true;
-        for (uint32 i = 0; i < str_count; ++i)
-        {
-            if (!str[i].empty())
-            {
-                if (wgname.find(str[i]) != std::wstring::npos ||
-                        wpname.find(str[i]) != std::wstring::npos ||
-                        Utf8FitTo(aname, str[i]))
-                {
-                    s_show = true;
-                    break;
-                }
-                s_show = false;
-            }
-        }
-        if (!s_show)
-            continue;
-
-        // 49 is maximum player count sent to client
-        ++matchcount;
-        if (matchcount > 49)
-            continue;
-
-        ++displaycount;
-
-        data << pname;                                      // player name
-        data << gname;                                      // guild name
-        data << uint32(lvl);                                // player level
-        data << uint32(class_);                             // player class
-        data << uint32(race);                               // player race
-        data << uint32(pzoneid);                            // player zone id
-    }
+    // players are listed from the who list snapshot, not from the live player map
+    uint32 matchcount = sWhoListCache.BuildWhoList(query, data, displaycount);
 
 	if (sConfig.GetBoolDefault("Dummy.Enable", false))
 	{
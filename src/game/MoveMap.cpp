@@ -320,6 +320,21 @@ namespace MMAP
         return true;
     }
 
+    uint32 MMapManager::getLoadedTileDataSize(uint32 mapId, int32 x, int32 y)
+    {
+        MMapDataSet::const_iterator itr = loadedMMaps.find(mapId);
+        if (itr == loadedMMaps.end())
+            return 0;
+
+        MMapData* mmap = itr->second;
+        MMapTileSet::const_iterator tileItr = mmap->mmapLoadedTiles.find(packTileID(x, y));
+        if (tileItr == mmap->mmapLoadedTiles.end())
+            return 0;
+
+        dtMeshTile const* tile = mmap->navMesh->getTileByRef(tileItr->second);
+        return tile ? uint32(tile->dataSize) : 0;
+    }
+
     dtNavMesh const* MMapManager::GetNavMesh(uint32 mapId)
     {
         if (loadedMMaps.find(mapId) == loadedMMaps.end())
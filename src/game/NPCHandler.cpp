@@ -561,28 +561,24 @@ void WorldSession::SendStablePet(ObjectGuid guid)
         ++num;
     }
 
-    //                                                     0      1     2   3      4      5        6
-    QueryResult* result = CharacterDatabase.PQuery("SELECT owner, slot, id, entry, level, loyalty, name FROM character_pet WHERE owner = '%u' AND slot >= '%u' AND slot <= '%u' ORDER BY slot",
-                          _player->GetGUIDLow(), PET_SAVE_FIRST_STABLE_SLOT, PET_SAVE_LAST_STABLE_SLOT);
-
-    if (result)
+    // stabled pets ordered by slot
+    PetRoster const& roster = _player->GetPetRoster();
+    for (uint32 slot = PET_SAVE_FIRST_STABLE_SLOT; slot <= PET_SAVE_LAST_STABLE_SLOT; ++slot)
     {
-        do
+        for (PetRoster::const_iterator itr = roster.begin(); itr != roster.end(); ++itr)
         {
-            Field* fields = result->Fetch();
+            if (itr->second.slot != slot)
+                continue;
 
-            data << uint32(fields[2].GetUInt32());          // petnumber
-            data << uint32(fields[3].GetUInt32());          // creature entry
-            data << uint32(fields[4].GetUInt32());          // level
-            data << fields[6].GetString();                  // name
-            data << uint32(fields[5].GetUInt32());          // loyalty
-            data << uint8(fields[1].GetUInt32() + 1);       // slot
+            data << uint32(itr->first);                     // petnumber
+            data << uint32(itr->second.entry);              // creature entry
+            data << uint32(itr->second.level);              // level
+            data << itr->second.name;                       // name
+            data << uint32(itr->second.loyalty);            // loyalty
+            data << uint8(slot + 1);                        // slot
 
             ++num;
         }
-        while (result->NextRow());
-
-        delete result;
     }
 
     data.put<uint8>(wpos, num);                             // set real data to placeholder
@@ -657,29 +653,7 @@ void WorldSession::HandleStablePet(WorldPacket& recv_data)
         return;
     }
 
-    uint32 free_slot = 1;
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT owner,slot,id FROM character_pet WHERE owner = '%u'  AND slot >= '%u' AND slot <= '%u' ORDER BY slot ",
-                          _player->GetGUIDLow(), PET_SAVE_FIRST_STABLE_SLOT, PET_SAVE_LAST_STABLE_SLOT);
-    if (result)
-    {
-        do
-        {
-            Field* fields = result->Fetch();
-
-            uint32 slot = fields[1].GetUInt32();
-
-            // slots ordered in query, and if not equal then free
-            if (slot != free_slot)
-                break;
-
-            // this slot not free, skip
-            ++free_slot;
-        }
-        while (result->NextRow());
-
-        delete result;
-    }
+    uint32 free_slot = _player->GetPetRosterFreeStableSlot();
 
     if (free_slot > 0 && free_slot <= GetPlayer()->m_stableSlots)
     {
@@ -714,16 +688,9 @@ void WorldSession::HandleUnstablePet(WorldPacket& recv_data)
 
     uint32 creature_id = 0;
 
-    {
-        QueryResult* result = CharacterDatabase.PQuery("SELECT entry FROM character_pet WHERE owner = '%u' AND id = '%u' AND slot >='%u' AND slot <= '%u'",
-                              _player->GetGUIDLow(), petnumber, PET_SAVE_FIRST_STABLE_SLOT, PET_SAVE_LAST_STABLE_SLOT);
-        if (result)
-        {
-            Field* fields = result->Fetch();
-            creature_id = fields[0].GetUInt32();
-            delete result;
-        }
-    }
+    PetRosterEntry const* petEntry = _player->GetPetRosterEntry(petnumber);
+    if (petEntry && petEntry->slot >= PET_SAVE_FIRST_STABLE_SLOT && petEntry->slot <= PET_SAVE_LAST_STABLE_SLOT)
+        creature_id = petEntry->entry;
 
     if (!creature_id)
     {
@@ -739,23 +706,20 @@ void WorldSession::HandleUnstablePet(WorldPacket& recv_data)
     }
 
     Pet* pet = _player->GetPet();
-	QueryResult* result = CharacterDatabase.PQuery("SELECT slot FROM character_pet WHERE owner = '%u'", _player->GetGUIDLow());
-	if (result)
-	{
-		do
-		{
-			Field* fields = result->Fetch();
-			uint32 slot = fields[0].GetUInt32();
-			if (!pet && slot == PET_SAVE_NOT_IN_SLOT)
-			{
-				SendStableResult(STABLE_ERR_STABLE);
-				delete result;
-				return;
-			}
-
-		} while (result->NextRow());
-		delete result;
-	}
+    // not let unstable while another pet is called off (not in slot)
+    if (!pet)
+    {
+        PetRoster const& roster = _player->GetPetRoster();
+        for (PetRoster::const_iterator itr = roster.begin(); itr != roster.end(); ++itr)
+        {
+            if (itr->second.slot == PET_SAVE_NOT_IN_SLOT)
+            {
+                SendStableResult(STABLE_ERR_STABLE);
+                return;
+            }
+        }
+    }
+
     if (pet && pet->isAlive())
     {
         SendStableResult(STABLE_ERR_STABLE);
@@ -851,19 +815,15 @@ void WorldSession::HandleStableSwapPet(WorldPacket& recv_data)
     }
 
     // find swapped pet slot in stable
-    QueryResult* result = CharacterDatabase.PQuery("SELECT slot,entry FROM character_pet WHERE owner = '%u' AND id = '%u'",
-                          _player->GetGUIDLow(), pet_number);
-    if (!result)
+    PetRosterEntry const* petEntry = _player->GetPetRosterEntry(pet_number);
+    if (!petEntry)
     {
         SendStableResult(STABLE_ERR_STABLE);
         return;
     }
 
-    Field* fields = result->Fetch();
-
-    uint32 slot        = fields[0].GetUInt32();
-    uint32 creature_id = fields[1].GetUInt32();
-    delete result;
+    uint32 slot        = petEntry->slot;
+    uint32 creature_id = petEntry->entry;
 
     if (!creature_id)
     {
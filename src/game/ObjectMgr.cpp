@@ -18,6 +18,7 @@
 
 #include "ObjectMgr.h"
 #include "Database/DatabaseEnv.h"
+#include "Database/DatabaseImpl.h"
 #include "Policies/Singleton.h"
 
 #include "SQLStorages.h"
@@ -127,7 +128,9 @@ ObjectMgr::ObjectMgr() :
     m_GroupIds("Group ids"),
     m_FirstTemporaryCreatureGuid(1),
     m_FirstTemporaryGameObjectGuid(1),
-    DBCLocaleIndex(LOCALE_enUS)
+    DBCLocaleIndex(LOCALE_enUS),
+    m_honorStanding(0),
+    m_oldMailsQueryPending(false)
 {
 }
 
@@ -959,8 +962,8 @@ void ObjectMgr::LoadCreatureModelInfo()
 void ObjectMgr::LoadCreatures()
 {
     uint32 count = 0;
-    //                                                0                       1   2    3
-    QueryResult* result = WorldDatabase.Query("SELECT creature.guid, creature.id, map, modelid,"
+    //                                                      0                       1   2    3
+    QueryResult* result = WorldDatabase.QueryStream("SELECT creature.guid, creature.id, map, modelid,"
                           //   4             5           6           7           8            9              10         11
                           "equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, spawndist, currentwaypoint,"
                           //   12         13       14          15            16
@@ -1131,8 +1134,8 @@ void ObjectMgr::LoadGameObjects()
 {
     uint32 count = 0;
 
-    //                                                0                           1   2    3           4           5           6
-    QueryResult* result = WorldDatabase.Query("SELECT gameobject.guid, gameobject.id, map, position_x, position_y, position_z, orientation,"
+    //                                                      0                           1   2    3           4           5           6
+    QueryResult* result = WorldDatabase.QueryStream("SELECT gameobject.guid, gameobject.id, map, position_x, position_y, position_z, orientation,"
                           //   7          8          9          10         11             12            13     14
                           "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, event,"
                           //   15                          16
@@ -2534,285 +2537,381 @@ void ObjectMgr::LoadPlayerInfo()
         }
     }
 }
-void ObjectMgr::LoadStandingList(uint32 dateBegin)
+#define HONOR_STANDING_BATCH_SIZE 250                       // rows per bulk statement of the weekly honor pipeline
+
+void HonorStandingWeek::Finalize()
 {
-    HonorStanding Standing;
+    // stable sort keeps the query order for equal honor, same as std::list::sort did
+    std::stable_sort(allyList.begin(), allyList.end());
+    std::stable_sort(hordeList.begin(), hordeList.end());
 
-    // needed for reload case
-    AllyHonorStandingList.clear();
-    HordeHonorStandingList.clear();
+    allyIndex.clear();
+    hordeIndex.clear();
 
-    uint32 guid, kills, side;
+    for (uint32 i = 0; i < allyList.size(); ++i)
+    {
+        allyList[i].position = i + 1;
+        allyIndex[allyList[i].guid] = i;
+    }
 
-    Field* fields = NULL;
-    QueryResult* result2 = NULL;
-    // this query create an ordered standing list
-    QueryResult* result = CharacterDatabase.PQuery("SELECT guid,SUM(honor) as honor_sum FROM character_honor_cp WHERE TYPE = %u AND date BETWEEN %u AND %u GROUP BY guid ORDER BY honor_sum DESC", HONORABLE, dateBegin, dateBegin + 7);
-    if (result)
+    for (uint32 i = 0; i < hordeList.size(); ++i)
     {
-        BarGoLink bar(result->GetRowCount());
+        hordeList[i].position = i + 1;
+        hordeIndex[hordeList[i].guid] = i;
+    }
+}
 
-        do
-        {
-            fields = result->Fetch();
-            guid  = fields[0].GetUInt32();
-            side = GetPlayerTeamByGUID(ObjectGuid(HIGHGUID_PLAYER, guid));
+void ObjectMgr::BuildHonorStandingWeek(HonorStandingWeek& week)
+{
+    uint32 dateBegin = week.dateBegin;
 
-            kills = 0;
-            // kills count with victim setted ( not zero value )
-            result2 = CharacterDatabase.PQuery("SELECT COUNT(*) FROM character_honor_cp WHERE guid = %u AND victim>0 AND TYPE = %u AND date BETWEEN %u AND %u", guid, HONORABLE, dateBegin, dateBegin + 7);
-            if (result2)
-                kills = result2->Fetch()->GetUInt32();
+    // one aggregate over the week: honor sum, kills with victim set (not zero value) and the character data used by distribution
+    QueryResult* result = CharacterDatabase.PQuery(
+                              "SELECT cp.guid, c.race, c.name, c.level, c.stored_honor_rating, SUM(cp.honor) AS honor_sum, SUM(CASE WHEN cp.victim > 0 THEN 1 ELSE 0 END) AS kills "
+                              "FROM character_honor_cp cp JOIN characters c ON c.guid = cp.guid "
+                              "WHERE cp.type = %u AND cp.date BETWEEN %u AND %u "
+                              "GROUP BY cp.guid, c.race, c.name, c.level, c.stored_honor_rating "
+                              // you need to reach CONFIG_UINT32_MIN_HONOR_KILLS to be added in standing list
+                              "HAVING SUM(CASE WHEN cp.victim > 0 THEN 1 ELSE 0 END) >= %u "
+                              // standing positions are assigned in result order
+                              "ORDER BY honor_sum DESC, cp.guid",
+                              HONORABLE, dateBegin, dateBegin + 7, sWorld.getConfig(CONFIG_UINT32_MIN_HONOR_KILLS));
 
-            // you need to reach CONFIG_UINT32_MIN_HONOR_KILLS to be added in standing list
-            if (kills < sWorld.getConfig(CONFIG_UINT32_MIN_HONOR_KILLS))
-                continue;
+    if (!result)
+    {
+        week.Finalize();
+        return;
+    }
 
-            Standing.guid = guid;
-            Standing.honorPoints = fields[1].GetUInt32();
-            Standing.honorKills = kills;
+    HonorStanding standing;
+    do
+    {
+        Field* fields = result->Fetch();
 
-            if (side == ALLIANCE)
-                AllyHonorStandingList.push_back(Standing);
-            else if (side == HORDE)
-                HordeHonorStandingList.push_back(Standing);
+        standing.guid        = fields[0].GetUInt32();
+        standing.name        = fields[2].GetCppString();
+        standing.level       = fields[3].GetUInt32();
+        standing.storedRP    = fields[4].GetFloat();
+        standing.honorPoints = fields[5].GetUInt32();
+        standing.honorKills  = fields[6].GetUInt32();
 
-            bar.step();
+        switch (Player::TeamForRace(fields[1].GetUInt8()))
+        {
+            case ALLIANCE: week.allyList.push_back(standing);  break;
+            case HORDE:    week.hordeList.push_back(standing); break;
+            default:                                           break;
+        }
+    }
+    while (result->NextRow());
+
+    delete result;
+
+    week.Finalize();
+
+    // dishonorable kills of the week for everyone at once
+    result = CharacterDatabase.PQuery("SELECT guid, COUNT(*) FROM character_honor_cp WHERE type = %u AND date BETWEEN %u AND %u GROUP BY guid",
+                                      DISHONORABLE, dateBegin, dateBegin + 7);
+    if (result)
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            uint32 guid = fields[0].GetUInt32();
+            uint32 kills = fields[1].GetUInt32();
+
+            HonorStandingIndex::const_iterator itr = week.allyIndex.find(guid);
+            if (itr != week.allyIndex.end())
+                week.allyList[itr->second].dishonorKills = kills;
+            else if ((itr = week.hordeIndex.find(guid)) != week.hordeIndex.end())
+                week.hordeList[itr->second].dishonorKills = kills;
         }
         while (result->NextRow());
 
         delete result;
-        delete result2;
+    }
+
+    DistributeRankPoints(week.allyList);
+    DistributeRankPoints(week.hordeList);
+}
 
-        // make sure all things are sorted
-        AllyHonorStandingList.sort();
-        HordeHonorStandingList.sort();
+void ObjectMgr::DistributeRankPoints(HonorStandingList& list)
+{
+    if (list.empty())
+        return;
+
+    HonorScores scores = MaNGOS::Honor::GenerateScores(list);
+    float maxRP = sWorld.getConfig(CONFIG_FLOAT_HONOR_PLAYER_MAX);
+
+    for (HonorStandingList::iterator itr = list.begin(); itr != list.end(); ++itr)
+    {
+        itr->rpEarning = MaNGOS::Honor::CalculateRpEarning(itr->honorPoints, scores);
+
+        float RP = MaNGOS::Honor::CalculateRpDecay(itr->rpEarning, itr->storedRP, itr->dishonorKills, MaNGOS::Honor::DishonorableKillPoints(itr->level));
+        RP = finiteAlways(RP);
+        itr->newRP = RP >= maxRP ? maxRP : RP;
     }
 }
 
-void ObjectMgr::LoadStandingList()
+void ObjectMgr::SaveHonorStandingWeek(HonorStandingWeek const& week)
 {
+    HonorStandingList const* lists[2] = { &week.allyList, &week.hordeList };
+
+    CharacterDatabase.BeginTransaction();
+
+    for (int side = 0; side < 2; ++side)
+    {
+        HonorStandingList const& list = *lists[side];
+
+        for (size_t first = 0; first < list.size(); first += HONOR_STANDING_BATCH_SIZE)
+        {
+            size_t last = std::min(list.size(), first + HONOR_STANDING_BATCH_SIZE);
+
+            std::ostringstream guids, standingCase, ratingCase, hkCase, dkCase, history;
+            standingCase << std::fixed;
+            ratingCase << std::fixed;
+            history << std::fixed;
+
+            for (size_t i = first; i < last; ++i)
+            {
+                HonorStanding const& st = list[i];
+                std::string name = st.name;
+                CharacterDatabase.escape_string(name);
+
+                if (i != first)
+                {
+                    guids << ",";
+                    history << ",";
+                }
+
+                guids << st.guid;
+                standingCase << " WHEN " << st.guid << " THEN " << st.position;
+                ratingCase << " WHEN " << st.guid << " THEN " << st.newRP;
+                hkCase << " WHEN " << st.guid << " THEN " << st.honorKills;
+                dkCase << " WHEN " << st.guid << " THEN " << st.dishonorKills;
+                history << "(" << st.guid << ",'" << name << "'," << week.dateBegin << "," << st.honorPoints << "," << st.rpEarning << ","
+                        << st.position << "," << st.newRP << "," << st.honorKills << "," << st.dishonorKills << "," << uint32(st.storedRP) << ")";
+            }
+
+            CharacterDatabase.PExecute("DELETE FROM character_honor_cp WHERE type = %u AND date BETWEEN %u AND %u AND guid IN (%s)",
+                                       HONORABLE, week.dateBegin, week.dateBegin + 7, guids.str().c_str());
 
-    uint32 LastWeekBegin = sWorld.GetDateLastMaintenanceDay() - 7;
-    LoadStandingList(LastWeekBegin);
+            std::ostringstream update;
+            update << "UPDATE characters SET honor_standing = CASE guid" << standingCase.str() << " END"
+                   << ", stored_honor_rating = CASE guid" << ratingCase.str() << " END"
+                   << ", stored_honorable_kills = stored_honorable_kills + CASE guid" << hkCase.str() << " END"
+                   << ", stored_dishonorable_kills = stored_dishonorable_kills + CASE guid" << dkCase.str() << " END"
+                   << " WHERE guid IN (" << guids.str() << ")";
+            CharacterDatabase.Execute(update.str().c_str());
+
+            std::string insert = "INSERT INTO character_history_honor (guid, name, week, honor_week, rp_week, standing_week, honor_total, kills, dishonor_kills, rp_lastweek) VALUES ";
+            insert += history.str();
+            CharacterDatabase.Execute(insert.c_str());
+        }
+    }
+
+    // the rest of the flush reads what was written here
+    CharacterDatabase.CommitTransactionDirect();
+}
+
+void ObjectMgr::LoadStandingList()
+{
+    uint32 startTime = WorldTimer::getMSTime();
 
     // distribution of RP earning without flushing table
-    DistributeRankPoints(ALLIANCE, LastWeekBegin);
-    DistributeRankPoints(HORDE, LastWeekBegin);
+    HonorStandingWeek week(sWorld.GetDateLastMaintenanceDay() - 7);
+    BuildHonorStandingWeek(week);
+
+    // needed for reload case
+    std::swap(m_honorStanding, week);
 
     sLog.outString();
-    sLog.outString(">> Loaded %u Horde and %u Ally honor standing definitions", HordeHonorStandingList.size(), AllyHonorStandingList.size());
+    sLog.outString(">> Loaded %u Horde and %u Ally honor standing definitions in %u ms", uint32(m_honorStanding.hordeList.size()), uint32(m_honorStanding.allyList.size()),
+                   WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime()));
 }
 
-
 void ObjectMgr::FlushRankPoints(uint32 dateTop)
 {
+    uint32 startTime = WorldTimer::getMSTime();
+    uint32 weeks = 0;
+
+    // standing of the latest flushed week, players in it have their rating already updated
+    HonorStandingWeek lastWeek(0);
+
     // FLUSH CP
-    QueryResult* result = CharacterDatabase.PQuery("SELECT date FROM character_honor_cp WHERE TYPE = %u AND date <= %u GROUP BY date ORDER BY date DESC", HONORABLE, dateTop);
+    // search latest non-processed date if the server has been offline for different weeks
+    QueryResult* result = CharacterDatabase.PQuery("SELECT MIN(date) FROM character_honor_cp WHERE type = %u AND date <= %u", HONORABLE, dateTop);
     if (result)
     {
-        uint32 date;
-        bool flush;
-        uint32 WeekBegin = dateTop - 7;
-        // search latest non-processed date if the server has been offline for different weeks
-        do
+        Field* fields = result->Fetch();
+        if (!fields[0].IsNULL())
         {
-            date = result->Fetch()->GetUInt32();
+            uint32 date = fields[0].GetUInt32();
+            uint32 WeekBegin = dateTop - 7;
             while (WeekBegin && date < WeekBegin)
-            {
                 WeekBegin -= 7;
+
+            // start to flush from latest non-processed date to up
+            while (WeekBegin < dateTop)
+            {
+                HonorStandingWeek week(WeekBegin);
+                BuildHonorStandingWeek(week);
+
+                // flush only with date < lastweek
+                if (WeekBegin <= dateTop - 7)
+                    SaveHonorStandingWeek(week);
+
+                std::swap(lastWeek, week);
+                WeekBegin += 7;
+                ++weeks;
             }
         }
-        while (result->NextRow());
 
-        // start to flush from latest non-processed date to up
-        while (WeekBegin < dateTop)
-        {
-            LoadStandingList(WeekBegin);
-
-            flush = WeekBegin <= dateTop - 7; // flush only with date < lastweek
-
-            DistributeRankPoints(ALLIANCE, WeekBegin, flush);
-            DistributeRankPoints(HORDE, WeekBegin, flush);
-
-            WeekBegin += 7;
-        }
-    }
-
-	QueryResult* resulta = CharacterDatabase.PQuery("SELECT guid, level, stored_honor_rating FROM characters WHERE stored_honor_rating > %u", 2000);
-	if (resulta)
-	{
-		do
-		{
-			Field *fields = resulta->Fetch();
-			uint32 guid = fields[0].GetUInt32();
-			uint32 level = fields[1].GetUInt32();
-			float RP = fields[2].GetFloat();
-			HonorStanding* standing_allance = sObjectMgr.GetHonorStandingByGUID(guid, ALLIANCE);
-			HonorStanding* standing_horde = sObjectMgr.GetHonorStandingByGUID(guid, HORDE);
-			if (!standing_allance && !standing_horde)
-			{
-				if (RP > 25000)
-					RP = RP * 0.9f;
-				if (RP <= 25000)
-					RP = RP - 2500 > 2000 ? RP - 2500 : 2000;
-
-				QueryResult* resultb = CharacterDatabase.PQuery("SELECT COUNT(*) AS kills FROM character_honor_cp WHERE date <= %u AND victim_type>0 AND guid = %u AND type = %u", dateTop - 7, guid, DISHONORABLE);
-				if (resultb)
-				{
-					do
-					{
-						Field *fieldsa = resultb->Fetch();
-						uint32 kills = fieldsa[0].GetUInt32();
-						float DK = kills * MaNGOS::Honor::DishonorableKillPoints(level);
-						RP = RP - DK > 0 ? RP - DK : 0;
-					}
-					while (resultb->NextRow());
-				}
-				CharacterDatabase.PExecute("UPDATE characters SET stored_honor_rating = %f WHERE guid = %u", RP, guid);
-			}
-		}
-		while (resulta->NextRow());
-	}
+        delete result;
+    }
+
+    uint32 standingTime = WorldTimer::getMSTime();
 
-    // FLUSH KILLS
-    CharacterDatabase.BeginTransaction();
-    // process only HK ( victim_type > 0 )
-    result = CharacterDatabase.PQuery("SELECT guid,TYPE,COUNT(*) AS kills FROM character_honor_cp WHERE date <= %u AND victim_type>0 GROUP BY guid,type", dateTop - 7);
+    // decay of players out of the standing, dishonorable kills counted for all of them in the same query
+    result = CharacterDatabase.PQuery("SELECT c.guid, c.level, c.stored_honor_rating, COUNT(cp.guid) FROM characters c "
+                                      "LEFT JOIN character_honor_cp cp ON cp.guid = c.guid AND cp.date <= %u AND cp.victim_type > 0 AND cp.type = %u "
+                                      "WHERE c.stored_honor_rating > %u GROUP BY c.guid, c.level, c.stored_honor_rating",
+                                      dateTop - 7, DISHONORABLE, 2000);
     if (result)
     {
-        uint32 guid, kills;
-        uint8 type;
-        Field* fields = NULL;
+        std::vector<std::pair<uint32, float> > decayed;
+
         do
         {
-            fields = result->Fetch();
-            guid   = fields[0].GetUInt32();
-            type   = fields[1].GetUInt8();
-            kills  = fields[2].GetUInt32();
+            Field* fields = result->Fetch();
+            uint32 guid = fields[0].GetUInt32();
+            if (lastWeek.allyIndex.find(guid) != lastWeek.allyIndex.end() || lastWeek.hordeIndex.find(guid) != lastWeek.hordeIndex.end())
+                continue;
+
+            uint32 level = fields[1].GetUInt32();
+            float RP = fields[2].GetFloat();
+            uint32 kills = fields[3].GetUInt32();
+
+            if (RP > 25000)
+                RP = RP * 0.9f;
+            if (RP <= 25000)
+                RP = RP - 2500 > 2000 ? RP - 2500 : 2000;
 
-            if (type == HONORABLE)
-                CharacterDatabase.PExecute("UPDATE characters SET stored_honorable_kills = stored_honorable_kills + %u WHERE guid = %u", kills, guid);
-            else if (type == DISHONORABLE)
-                CharacterDatabase.PExecute("UPDATE characters SET stored_dishonorable_kills = stored_dishonorable_kills + %u WHERE guid = %u", kills, guid);
+            float DK = kills * MaNGOS::Honor::DishonorableKillPoints(level);
+            RP = RP - DK > 0 ? RP - DK : 0;
+
+            decayed.push_back(std::make_pair(guid, RP));
         }
         while (result->NextRow());
-    }
 
-    // cleanin ALL cp before dateTop
-    CharacterDatabase.PExecute("DELETE FROM character_honor_cp WHERE date <= %u", dateTop);
-    CharacterDatabase.CommitTransaction();
+        delete result;
 
-    sLog.outString();
-    sLog.outString(">> Flushed all ranking points");
+        CharacterDatabase.BeginTransaction();
+        for (size_t first = 0; first < decayed.size(); first += HONOR_STANDING_BATCH_SIZE)
+        {
+            size_t last = std::min(decayed.size(), first + HONOR_STANDING_BATCH_SIZE);
 
-    delete result;
-}
+            std::ostringstream ratingCase, guids;
+            ratingCase << std::fixed;
+            for (size_t i = first; i < last; ++i)
+            {
+                if (i != first)
+                    guids << ",";
+                guids << decayed[i].first;
+                ratingCase << " WHEN " << decayed[i].first << " THEN " << decayed[i].second;
+            }
 
-void ObjectMgr::DistributeRankPoints(uint32 team, uint32 dateBegin, bool flush /*false*/)
-{
-	float RP;
-	float last_RP;
-	uint32 HK;
-	uint32 level;
-	uint32 DK = 0;
-	std::string name;
+            std::ostringstream update;
+            update << "UPDATE characters SET stored_honor_rating = CASE guid" << ratingCase.str() << " END WHERE guid IN (" << guids.str() << ")";
+            CharacterDatabase.Execute(update.str().c_str());
+        }
+        CharacterDatabase.CommitTransactionDirect();
+    }
 
-	HonorStandingList list = GetStandingListBySide(team);
+    uint32 decayTime = WorldTimer::getMSTime();
+
+    // FLUSH KILLS
+    CharacterDatabase.BeginTransaction();
+    // process only HK ( victim_type > 0 )
+    result = CharacterDatabase.PQuery("SELECT guid,TYPE,COUNT(*) AS kills FROM character_honor_cp WHERE date <= %u AND victim_type>0 GROUP BY guid,type", dateTop - 7);
+    if (result)
+    {
+        std::ostringstream hkCase, dkCase, hkGuids, dkGuids;
+        uint32 hkCount = 0, dkCount = 0;
 
-	if (list.empty())
-		return;
+        do
+        {
+            Field* fields = result->Fetch();
+            uint32 guid  = fields[0].GetUInt32();
+            uint8 type   = fields[1].GetUInt8();
+            uint32 kills = fields[2].GetUInt32();
 
-	HonorScores scores = MaNGOS::Honor::GenerateScores(list, team);
+            if (type != HONORABLE && type != DISHONORABLE)
+                continue;
 
-	Field* fields = NULL;
-	QueryResult* result = NULL;
-	for (HonorStandingList::iterator itr = list.begin(); itr != list.end(); ++itr)
-	{
-		RP = 0;
-		result = CharacterDatabase.PQuery("SELECT name, level, stored_honor_rating,stored_dishonorable_kills, stored_honorable_kills FROM characters WHERE guid = %u ", itr->guid);
-		if (!result)
-			continue; // not cleaned table?
+            std::ostringstream& killCase = type == HONORABLE ? hkCase : dkCase;
+            std::ostringstream& killGuids = type == HONORABLE ? hkGuids : dkGuids;
+            uint32& count = type == HONORABLE ? hkCount : dkCount;
 
-		QueryResult* resulta = CharacterDatabase.PQuery("SELECT COUNT(*) AS kills FROM character_honor_cp WHERE guid = %u AND TYPE = %u AND date BETWEEN %u AND %u", itr->guid, DISHONORABLE, dateBegin, dateBegin + 7);
-		if (resulta)
-		{
-			fields = resulta->Fetch();
-			DK = fields[0].GetUInt32();
-		}
-		fields = result->Fetch();
-		name = fields[0].GetCppString();
-		level = fields[1].GetUInt32();
-		RP = fields[2].GetFloat();
-		HK = fields[3].GetUInt32();
-		last_RP = RP;
+            killCase << " WHEN " << guid << " THEN " << kills;
+            killGuids << (count ? "," : "") << guid;
 
-		itr->rpEarning = MaNGOS::Honor::CalculateRpEarning(itr->GetInfo()->honorPoints, scores);
-		RP = MaNGOS::Honor::CalculateRpDecay(itr->rpEarning, RP, DK, MaNGOS::Honor::DishonorableKillPoints(level));
-		RP = finiteAlways(RP) >= sWorld.getConfig(CONFIG_FLOAT_HONOR_PLAYER_MAX) ? sWorld.getConfig(CONFIG_FLOAT_HONOR_PLAYER_MAX) : finiteAlways(RP);
-		if (flush)
-		{
-			CharacterDatabase.BeginTransaction();
-			CharacterDatabase.PExecute("DELETE FROM character_honor_cp WHERE guid = %u AND TYPE = %u AND date BETWEEN %u AND %u", itr->guid, HONORABLE, dateBegin, dateBegin + 7);
-			CharacterDatabase.PExecute("UPDATE characters SET honor_standing = %u, stored_honor_rating = %f , stored_honorable_kills = stored_honorable_kills + %u, stored_dishonorable_kills = stored_dishonorable_kills + %u WHERE guid = %u", GetHonorStandingPositionByGUID(itr->guid, team), RP, itr->honorKills, DK, itr->guid);
-			CharacterDatabase.PExecute("INSERT INTO character_history_honor (guid, name, week, honor_week, rp_week, standing_week, honor_total,kills,dishonor_kills,rp_lastweek) VALUES (%u, '%s', %u, %f, %f, %u, %f, %u, %u, %u)", itr->guid, name.c_str(), dateBegin, itr->GetInfo()->honorPoints, itr->rpEarning, GetHonorStandingPositionByGUID(itr->guid, team), RP, itr->honorKills, DK, uint32(last_RP));
-			CharacterDatabase.CommitTransaction();
-		}
-	}
+            if (++count >= HONOR_STANDING_BATCH_SIZE)
+            {
+                CharacterDatabase.PExecute("UPDATE characters SET %s = %s + CASE guid%s END WHERE guid IN (%s)",
+                                           type == HONORABLE ? "stored_honorable_kills" : "stored_dishonorable_kills",
+                                           type == HONORABLE ? "stored_honorable_kills" : "stored_dishonorable_kills",
+                                           killCase.str().c_str(), killGuids.str().c_str());
+                killCase.str("");
+                killGuids.str("");
+                count = 0;
+            }
+        }
+        while (result->NextRow());
 
-	delete result;
-}
+        delete result;
 
-HonorStandingList ObjectMgr::GetStandingListBySide(uint32 side)
-{
-    switch (side)
-    {
-        case ALLIANCE: return AllyHonorStandingList;
-        case HORDE:    return HordeHonorStandingList;
-        default:       return AllyHonorStandingList; // mustn't happen
+        if (hkCount)
+            CharacterDatabase.PExecute("UPDATE characters SET stored_honorable_kills = stored_honorable_kills + CASE guid%s END WHERE guid IN (%s)", hkCase.str().c_str(), hkGuids.str().c_str());
+        if (dkCount)
+            CharacterDatabase.PExecute("UPDATE characters SET stored_dishonorable_kills = stored_dishonorable_kills + CASE guid%s END WHERE guid IN (%s)", dkCase.str().c_str(), dkGuids.str().c_str());
     }
+
+    // cleanin ALL cp before dateTop
+    CharacterDatabase.PExecute("DELETE FROM character_honor_cp WHERE date <= %u", dateTop);
+    CharacterDatabase.CommitTransactionDirect();
+
+    uint32 endTime = WorldTimer::getMSTime();
+
+    sLog.outString();
+    sLog.outString(">> Flushed all ranking points: %u week(s) standing %u ms, decay %u ms, kills %u ms",
+                   weeks, WorldTimer::getMSTimeDiff(startTime, standingTime), WorldTimer::getMSTimeDiff(standingTime, decayTime), WorldTimer::getMSTimeDiff(decayTime, endTime));
 }
 
 HonorStanding* ObjectMgr::GetHonorStandingByGUID(uint32 guid, uint32 side)
 {
-    HonorStandingList standingList = sObjectMgr.GetStandingListBySide(side);
+    HonorStandingIndex const& index = sObjectMgr.m_honorStanding.GetIndexBySide(side);
 
-    for (HonorStandingList::iterator itr = standingList.begin(); itr != standingList.end() ; ++itr)
-        if (itr->guid == guid)
-            return itr->GetInfo();
+    HonorStandingIndex::const_iterator itr = index.find(guid);
+    if (itr == index.end())
+        return NULL;
 
-    return 0;
+    return &sObjectMgr.GetStandingListBySide(side)[itr->second];
 }
 
-
 HonorStanding* ObjectMgr::GetHonorStandingByPosition(uint32 position, uint32 side)
 {
-    HonorStandingList standingList = sObjectMgr.GetStandingListBySide(side);
-    uint32 pos = 1;
+    HonorStandingList& standingList = sObjectMgr.GetStandingListBySide(side);
 
-    for (HonorStandingList::iterator itr = standingList.begin(); itr != standingList.end() ; ++itr)
-    {
-        if (pos == position)
-            return itr->GetInfo();
-        pos++;
-    }
+    if (!position || position > standingList.size())
+        return NULL;
 
-    return 0;
+    return &standingList[position - 1];
 }
 
 uint32 ObjectMgr::GetHonorStandingPositionByGUID(uint32 guid, uint32 side)
 {
-    HonorStandingList standingList = sObjectMgr.GetStandingListBySide(side);
-    uint32 pos = 1;
-
-    for (HonorStandingList::iterator itr = standingList.begin(); itr != standingList.end() ; ++itr)
-    {
-        if (itr->guid == guid)
-            return pos;
-        pos++;
-    }
-
-    return 0;
+    HonorStanding* standing = GetHonorStandingByGUID(guid, side);
+    return standing ? standing->position : 0;
 }
 
 void ObjectMgr::GetPlayerClassLevelInfo(uint32 class_, uint32 level, PlayerClassLevelInfo* info) const
@@ -4459,45 +4558,158 @@ void ObjectMgr::LoadGossipTextLocales()
     sLog.outString();
 }
 
-// not very fast function but it is called only once a day, or on starting-up
-/// @param serverUp true if the server is already running, false when the server is started
+// expiration index of all mails in DB, filled at startup and then by every sent or returned mail
+// ReturnOrDeleteOldMails takes the expired ids from it in batches of MailReturnPerTick each world tick
+void ObjectMgr::AddMailExpiration(uint32 mailId, time_t expireTime)
+{
+    ACE_Guard<ACE_Thread_Mutex> guard(m_mailExpirationsLock);
+    m_mailExpirations.push(MailExpiration(expireTime, mailId));
+}
+
+bool ObjectMgr::PopExpiredMails(time_t now, uint32 maxCount, std::string& mailIds)
+{
+    std::set<uint32> ids;
+
+    {
+        ACE_Guard<ACE_Thread_Mutex> guard(m_mailExpirationsLock);
+        // an id can be queued more than once (returned mail), the mail query filters outdated entries
+        while (!m_mailExpirations.empty() && m_mailExpirations.top().expireTime < now && ids.size() < maxCount)
+        {
+            ids.insert(m_mailExpirations.top().mailId);
+            m_mailExpirations.pop();
+        }
+    }
+
+    if (ids.empty())
+        return false;
+
+    std::ostringstream ss;
+    for (std::set<uint32>::const_iterator itr = ids.begin(); itr != ids.end(); ++itr)
+    {
+        if (itr != ids.begin())
+            ss << ",";
+        ss << *itr;
+    }
+
+    mailIds = ss.str();
+    return true;
+}
+
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
     time_t basetime = time(NULL);
+
+    if (serverUp)
+    {
+        // one batch at a time, next one is sent after the results of this one are processed
+        if (m_oldMailsQueryPending)
+            return;
+
+        std::string mailIds;
+        if (!PopExpiredMails(basetime, sWorld.getConfig(CONFIG_UINT32_MAIL_RETURN_PER_TICK), mailIds))
+            return;
+
+        SqlQueryHolder* holder = new SqlQueryHolder;
+        holder->SetSize(2);
+        //                           0  1           2      3        4          5         6           7   8       9
+        holder->SetPQuery(0, "SELECT id,messageType,sender,receiver,itemTextId,has_items,expire_time,cod,checked,mailTemplateId FROM mail WHERE expire_time < '" UI64FMTD "' AND id IN (%s)", (uint64)basetime, mailIds.c_str());
+        holder->SetPQuery(1, "SELECT mail_id,item_guid,item_template FROM mail_items WHERE mail_id IN (%s)", mailIds.c_str());
+
+        m_oldMailsQueryPending = CharacterDatabase.DelayQueryHolder(this, &ObjectMgr::ReturnOrDeleteOldMailsCallback, holder);
+        if (!m_oldMailsQueryPending)
+            delete holder;
+        return;
+    }
+
     DEBUG_LOG("Returning mails current time: hour: %d, minute: %d, second: %d ", localtime(&basetime)->tm_hour, localtime(&basetime)->tm_min, localtime(&basetime)->tm_sec);
     // delete all old mails without item and without body immediately, if starting server
-    if (!serverUp)
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE expire_time < '" UI64FMTD "' AND has_items = '0' AND itemTextId = 0", (uint64)basetime);
-    //                                                     0  1           2      3        4          5         6           7   8       9
-    QueryResult* result = CharacterDatabase.PQuery("SELECT id,messageType,sender,receiver,itemTextId,has_items,expire_time,cod,checked,mailTemplateId FROM mail WHERE expire_time < '" UI64FMTD "'", (uint64)basetime);
-    if (!result)
+    CharacterDatabase.PExecute("DELETE FROM mail WHERE expire_time < '" UI64FMTD "' AND has_items = '0' AND itemTextId = 0", (uint64)basetime);
+
+    // fill expiration index, later kept up to date by mail sending
+    std::vector<MailExpiration> expirations;
+    QueryResult* result = CharacterDatabase.Query("SELECT id,expire_time FROM mail");
+    if (result)
     {
-        BarGoLink bar(1);
-        bar.step();
-        sLog.outString(">> Only expired mails (need to be return or delete) or DB table `mail` is empty.");
-        sLog.outString();
-        return;                                             // any mails need to be returned or deleted
+        expirations.reserve(result->GetRowCount());
+        do
+        {
+            Field* fields = result->Fetch();
+            expirations.push_back(MailExpiration((time_t)fields[1].GetUInt64(), fields[0].GetUInt32()));
+        }
+        while (result->NextRow());
+
+        delete result;
     }
 
-    // std::ostringstream delitems, delmails; // will be here for optimization
-    // bool deletemail = false, deleteitem = false;
-    // delitems << "DELETE FROM item_instance WHERE guid IN ( ";
-    // delmails << "DELETE FROM mail WHERE id IN ( "
+    {
+        ACE_Guard<ACE_Thread_Mutex> guard(m_mailExpirationsLock);
+        m_mailExpirations = MailExpirationQueue(std::less<MailExpiration>(), expirations);
+    }
 
-    BarGoLink bar(result->GetRowCount());
-    uint32 count = 0;
-    Field* fields;
+    uint32 indexed = expirations.size();
+    expirations.clear();
 
-    do
+    // at startup nobody is online, so process all expired mails now
+    uint32 batches = 0;
+    std::string mailIds;
+    while (PopExpiredMails(basetime, sWorld.getConfig(CONFIG_UINT32_MAIL_RETURN_PER_TICK), mailIds))
     {
-        bar.step();
+        //                                                     0  1           2      3        4          5         6           7   8       9
+        QueryResult* mails = CharacterDatabase.PQuery("SELECT id,messageType,sender,receiver,itemTextId,has_items,expire_time,cod,checked,mailTemplateId FROM mail WHERE expire_time < '" UI64FMTD "' AND id IN (%s)", (uint64)basetime, mailIds.c_str());
+        QueryResult* items = CharacterDatabase.PQuery("SELECT mail_id,item_guid,item_template FROM mail_items WHERE mail_id IN (%s)", mailIds.c_str());
+        ReturnOrDeleteOldMails(mails, items, false);
+        ++batches;
+    }
 
-        fields = result->Fetch();
+    sLog.outString(">> Indexed %u mails, processed expired ones in %u batches", indexed, batches);
+    sLog.outString();
+}
+
+void ObjectMgr::ReturnOrDeleteOldMailsCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
+{
+    m_oldMailsQueryPending = false;
+
+    ReturnOrDeleteOldMails(holder->GetResult(0), holder->GetResult(1), true);
+    delete holder;
+}
+
+void ObjectMgr::ReturnOrDeleteOldMails(QueryResult* mails, QueryResult* items, bool serverUp)
+{
+    typedef std::multimap<uint32, MailItemInfo> MailItemsMap;
+    MailItemsMap mailItems;
+
+    if (items)
+    {
+        do
+        {
+            Field* fields = items->Fetch();
+
+            MailItemInfo mii;
+            mii.item_guid = fields[1].GetUInt32();
+            mii.item_template = fields[2].GetUInt32();
+            mailItems.insert(MailItemsMap::value_type(fields[0].GetUInt32(), mii));
+        }
+        while (items->NextRow());
+
+        delete items;
+    }
+
+    if (!mails)
+        return;
+
+    time_t basetime = time(NULL);
+
+    std::ostringstream delItems, delTexts, delMails;
+
+    do
+    {
+        Field* fields = mails->Fetch();
         Mail* m = new Mail;
         m->messageID = fields[0].GetUInt32();
         m->messageType = fields[1].GetUInt8();
         m->sender = fields[2].GetUInt32();
         m->receiverGuid = ObjectGuid(HIGHGUID_PLAYER, fields[3].GetUInt32());
+        m->itemTextId = fields[4].GetUInt32();
         bool has_items = fields[5].GetBool();
         m->expire_time = (time_t)fields[6].GetUInt64();
         m->deliver_time = 0;
@@ -4510,67 +4722,62 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             pl = GetPlayer(m->receiverGuid);
         if (pl)
         {
-            // this code will run very improbably (the time is between 4 and 5 am, in game is online a player, who has old mail
-            // his in mailbox and he has already listed his mails )
+            // receiver has the mail loaded and will save it with own data, try again after he logs out
+            AddMailExpiration(m->messageID, basetime + HOUR);
             delete m;
             continue;
         }
         // delete or return mail:
         if (has_items)
         {
-            QueryResult* resultItems = CharacterDatabase.PQuery("SELECT item_guid,item_template FROM mail_items WHERE mail_id='%u'", m->messageID);
-            if (resultItems)
-            {
-                do
-                {
-                    Field* fields2 = resultItems->Fetch();
-
-                    uint32 item_guid_low = fields2[0].GetUInt32();
-                    uint32 item_template = fields2[1].GetUInt32();
+            std::pair<MailItemsMap::const_iterator, MailItemsMap::const_iterator> bounds = mailItems.equal_range(m->messageID);
+            for (MailItemsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+                m->AddItem(itr->second.item_guid, itr->second.item_template);
 
-                    m->AddItem(item_guid_low, item_template);
-                }
-                while (resultItems->NextRow());
-
-                delete resultItems;
-            }
             // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
             if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
             {
                 // mail open and then not returned
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                    CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", itr2->item_guid);
+                    delItems << (delItems.tellp() > 0 ? "," : "") << itr2->item_guid;
             }
             else
             {
                 // mail will be returned:
                 CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u'",
                                            m->receiverGuid.GetCounter(), m->sender, (uint64)(basetime + 30 * DAY), (uint64)basetime, MAIL_CHECK_MASK_RETURNED, m->messageID);
+                // update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                CharacterDatabase.PExecute("UPDATE mail_items SET receiver = %u WHERE mail_id = '%u'", m->sender, m->messageID);
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    // update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    CharacterDatabase.PExecute("UPDATE mail_items SET receiver = %u WHERE item_guid = '%u'", m->sender, itr2->item_guid);
                     CharacterDatabase.PExecute("UPDATE item_instance SET owner_guid = %u WHERE guid = '%u'", m->sender, itr2->item_guid);
-                }
+
+                AddMailExpiration(m->messageID, basetime + 30 * DAY);
                 delete m;
                 continue;
             }
         }
 
         if (m->itemTextId)
-            CharacterDatabase.PExecute("DELETE FROM item_text WHERE id = '%u'", m->itemTextId);
+            delTexts << (delTexts.tellp() > 0 ? "," : "") << m->itemTextId;
 
-        // deletemail = true;
-        // delmails << m->messageID << ", ";
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", m->messageID);
+        delMails << (delMails.tellp() > 0 ? "," : "") << m->messageID;
         delete m;
-        ++count;
     }
-    while (result->NextRow());
-    delete result;
+    while (mails->NextRow());
 
-    sLog.outString(">> Loaded %u mails", count);
-    sLog.outString();
+    delete mails;
+
+    if (delItems.tellp() > 0)
+        CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid IN (%s)", delItems.str().c_str());
+
+    if (delTexts.tellp() > 0)
+        CharacterDatabase.PExecute("DELETE FROM item_text WHERE id IN (%s)", delTexts.str().c_str());
+
+    if (delMails.tellp() > 0)
+    {
+        CharacterDatabase.PExecute("DELETE FROM mail_items WHERE mail_id IN (%s)", delMails.str().c_str());
+        CharacterDatabase.PExecute("DELETE FROM mail WHERE id IN (%s)", delMails.str().c_str());
+    }
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
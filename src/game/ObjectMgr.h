@@ -39,6 +39,7 @@
 
 #include <string>
 #include <map>
+#include <queue>
 #include <limits>
 
 class Group;
@@ -407,23 +408,69 @@ class HonorStanding
             honorKills  = 0;
             guid        = 0;
             rpEarning   = 0;
+            position    = 0;
+            dishonorKills = 0;
+            level       = 0;
+            storedRP    = 0;
+            newRP       = 0;
         }
 
         float honorPoints;
         uint32 honorKills;
         uint32 guid;
         float rpEarning;
+        uint32 position;                                    // 1-based, valid after HonorStandingWeek::Finalize
+
+        // filled only by the weekly standing pipeline (see ObjectMgr::BuildHonorStandingWeek)
+        uint32 dishonorKills;
+        uint32 level;
+        float storedRP;                                     // characters.stored_honor_rating before distribution
+        float newRP;                                        // stored_honor_rating after decay and distribution
+        std::string name;
 
         HonorStanding* GetInfo() { return this; };
 
         // create the standing order
-        bool operator < (const HonorStanding& rhs)
+        bool operator < (const HonorStanding& rhs) const
         {
             return honorPoints > rhs.honorPoints;
         }
 };
 
-typedef std::list<HonorStanding> HonorStandingList;
+typedef std::vector<HonorStanding> HonorStandingList;
+typedef UNORDERED_MAP<uint32 /*guid*/, uint32 /*index in HonorStandingList*/> HonorStandingIndex;
+
+// Standing of both factions for one honor week. Built from a couple of set-based
+// queries and owns all its data, so it can be computed outside of the world thread.
+struct HonorStandingWeek
+{
+    explicit HonorStandingWeek(uint32 _dateBegin) : dateBegin(_dateBegin) {}
+
+    HonorStandingList& GetListBySide(uint32 side) { return side == HORDE ? hordeList : allyList; }
+    HonorStandingIndex& GetIndexBySide(uint32 side) { return side == HORDE ? hordeIndex : allyIndex; }
+
+    // sort standings, set positions and rebuild guid lookup indexes
+    void Finalize();
+
+    uint32 dateBegin;
+    HonorStandingList allyList;
+    HonorStandingList hordeList;
+    HonorStandingIndex allyIndex;
+    HonorStandingIndex hordeIndex;
+};
+
+// mail id with its expire time, ordered so the priority queue top is the earliest expiration
+struct MailExpiration
+{
+    MailExpiration(time_t _expireTime, uint32 _mailId) : expireTime(_expireTime), mailId(_mailId) {}
+
+    bool operator < (MailExpiration const& rhs) const { return expireTime > rhs.expireTime; }
+
+    time_t expireTime;
+    uint32 mailId;
+};
+
+typedef std::priority_queue<MailExpiration> MailExpirationQueue;
 
 template<typename T>
 class IdGenerator
@@ -700,15 +747,22 @@ class ObjectMgr
 
         static HonorStanding* GetHonorStandingByGUID(uint32 guid, uint32 side);
         static HonorStanding* GetHonorStandingByPosition(uint32 position, uint32 side);
-        HonorStandingList GetStandingListBySide(uint32 side);
+        HonorStandingList& GetStandingListBySide(uint32 side) { return m_honorStanding.GetListBySide(side); }
         uint32 GetHonorStandingPositionByGUID(uint32 guid, uint32 side);
-        void UpdateHonorStandingByGuid(uint32 guid, HonorStanding standing, uint32 side) ;
-        void FlushRankPoints(uint32 dateTop);
-        void DistributeRankPoints(uint32 team, uint32 dateBegin , bool flush = false);
-        void LoadStandingList(uint32 dateBegin);
         void LoadStandingList();
 
+        // weekly honor pipeline, does not touch ObjectMgr state so it is safe to run from a worker thread
+        static void FlushRankPoints(uint32 dateTop);
+        static void BuildHonorStandingWeek(HonorStandingWeek& week);
+        static void DistributeRankPoints(HonorStandingList& list);
+        static void SaveHonorStandingWeek(HonorStandingWeek const& week);
+
+        // startup: load the mail expiration index and process all expired mails
+        // runtime: send the next batch of expired mails to return or delete, results are handled in a later tick
         void ReturnOrDeleteOldMails(bool serverUp);
+        void ReturnOrDeleteOldMailsCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder);
+        // thread safe, called for every mail stored with a new expire time
+        void AddMailExpiration(uint32 mailId, time_t expireTime);
 
         void SetHighestGuids();
 
@@ -1124,8 +1178,15 @@ class ObjectMgr
         FishingBaseSkillMap mFishingBaseForArea;
 
         // Standing System
-        HonorStandingList HordeHonorStandingList;
-        HonorStandingList AllyHonorStandingList;
+        HonorStandingWeek m_honorStanding;
+
+        // Expired mails
+        bool PopExpiredMails(time_t now, uint32 maxCount, std::string& mailIds);
+        void ReturnOrDeleteOldMails(QueryResult* mails, QueryResult* items, bool serverUp);
+
+        MailExpirationQueue m_mailExpirations;
+        ACE_Thread_Mutex m_mailExpirationsLock;
+        bool m_oldMailsQueryPending;
 
         typedef std::map<uint32, std::vector<std::string> > HalfNameMap;
         HalfNameMap PetHalfName0;
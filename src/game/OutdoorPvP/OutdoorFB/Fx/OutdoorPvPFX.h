@@ -83,7 +83,7 @@ class OutdoorPvPFX : public OutdoorPvP
     public:
         OutdoorPvPFX();
 
-		void Update(uint32 diff) override;
+		void UpdateMap(Map* map, uint32 diff) override;
 
     private:
 };
@@ -63,7 +63,7 @@ class OutdoorPvPTS : public OutdoorPvP
 public:
 	OutdoorPvPTS();
 
-	void Update(uint32 diff) override;
+	void UpdateMap(Map* map, uint32 diff) override;
 
 private:
 };
@@ -24,35 +24,35 @@ OutdoorPvPZG::OutdoorPvPZG() : OutdoorPvP()
 {
 }
 
-void OutdoorPvPZG::Update(uint32 diff)
+void OutdoorPvPZG::UpdateMap(Map* map, uint32 /*diff*/)
 {
-	for (GuidZoneMap::const_iterator itr = m_zonePlayers.begin(); itr != m_zonePlayers.end(); ++itr)
+	// only group members at this map instance are counted, players at other instances are updated by their own map
+	std::set<Player*> overLimit;
+
+	Map::PlayerList const& players = map->GetPlayers();
+	for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
 	{
-		if (!itr->second)
+		Player* player = itr->getSource();
+		if (!player->IsInWorld() || player->GetZoneId() != ZONE_ID_BUFF_ZG)
 			continue;
 
-		if (Player* player = sObjectMgr.GetPlayer(itr->first))
+		if (Group* pGroup = player->GetGroup())
 		{
-			if (Group* pGroup = player->GetGroup())
+			uint8 m_sy1 = 0;
+			for (GroupReference* gItr = pGroup->GetFirstMember(); gItr != NULL; gItr = gItr->next())
 			{
-				if (pGroup)
+				Player* pPlayer = gItr->getSource();
+				if (pPlayer->IsInWorld() && pPlayer->GetMap() == map)
 				{
-					uint8 m_sy1 = 0;
-					for (GroupReference* itr = pGroup->GetFirstMember(); itr != NULL; itr = itr->next())
-					{
-						Player* pPlayer = itr->getSource();
-						if (pPlayer->IsInWorld())
-						{
-							if (pPlayer->GetMapId() == MAP_ID_ZG)
-							{
-								++m_sy1;
-								if (m_sy1 > 20)
-									pPlayer->TeleportToHomebind();
-							}
-						}
-					}
+					++m_sy1;
+					if (m_sy1 > 20)
+						overLimit.insert(pPlayer);
 				}
 			}
 		}
 	}
+
+	// teleport after the loop, leaving the map changes its player list
+	for (std::set<Player*>::const_iterator itr = overLimit.begin(); itr != overLimit.end(); ++itr)
+		(*itr)->TeleportToHomebind();
 }
\ No newline at end of file
@@ -83,7 +83,7 @@ class OutdoorPvPZG : public OutdoorPvP
     public:
         OutdoorPvPZG();
 
-		void Update(uint32 diff) override;
+		void UpdateMap(Map* map, uint32 diff) override;
 
     private:
 };
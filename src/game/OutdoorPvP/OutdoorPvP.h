@@ -162,9 +162,12 @@ class OutdoorPvP
         // called when a player drops a flag
         virtual bool HandleDropFlag(Player* /*player*/, uint32 /*spellId*/) { return false; }
 
-        // update - called by the OutdoorPvPMgr
+        // update - called by the OutdoorPvPMgr in world thread
         virtual void Update(uint32 /*diff*/) {}
 
+        // update - called by the OutdoorPvPMgr from update thread of each map (instance) the script zone is located at
+        virtual void UpdateMap(Map* /*map*/, uint32 /*diff*/) {}
+
         // Handle player kill
         void HandlePlayerKill(Player* killer, Player* victim);
 
@@ -21,6 +21,8 @@
 #include "OutdoorPvP.h"
 #include "World.h"
 #include "Log.h"
+#include "Map.h"
+#include "DBCStores.h"
 #include "OutdoorPvPEP.h"
 #include "OutdoorPvPSI.h"
 #include "OutdoorFB/Hsts/OutdoorPvPTS.h"
@@ -30,10 +32,24 @@
 
 INSTANTIATE_SINGLETON_1(OutdoorPvPMgr);
 
+// main zone of each script, in OutdoorPvPTypes order
+static uint32 const OutdoorPvPScriptZones[MAX_OPVP_ID] =
+{
+    ZONE_ID_SILITHUS,
+    ZONE_ID_EASTERN_PLAGUELANDS,
+    ZONE_ID_BUFF_TS,
+    ZONE_ID_BUFF_ZG,
+    ZONE_ID_BUFF_FX,
+    ZONE_ID_BUFF_EY,
+};
+
 OutdoorPvPMgr::OutdoorPvPMgr()
 {
     m_updateTimer.SetInterval(TIMER_OPVP_MGR_UPDATE);
     memset(&m_scripts, 0, sizeof(m_scripts));
+
+    for (uint8 i = 0; i < MAX_OPVP_ID; ++i)
+        m_scriptMapIds[i] = OPVP_MAP_NONE;
 }
 
 OutdoorPvPMgr::~OutdoorPvPMgr()
@@ -62,6 +78,12 @@ void OutdoorPvPMgr::InitOutdoorPvP()
 	LOAD_OPVP_ZONE(FX);
 	LOAD_OPVP_ZONE(EY);
 
+    for (uint8 i = 0; i < MAX_OPVP_ID; ++i)
+    {
+        if (AreaTableEntry const* zoneEntry = GetAreaEntryByAreaID(OutdoorPvPScriptZones[i]))
+            m_scriptMapIds[i] = zoneEntry->mapid;
+    }
+
     sLog.outString(">> Loaded %u Outdoor PvP zones", counter);
     sLog.outString();
 }
@@ -141,3 +163,10 @@ void OutdoorPvPMgr::Update(uint32 diff)
 
     m_updateTimer.Reset();
 }
+
+void OutdoorPvPMgr::UpdateMap(Map* map, uint32 diff)
+{
+    for (uint8 i = 0; i < MAX_OPVP_ID; ++i)
+        if (m_scripts[i] && m_scriptMapIds[i] == map->GetId())
+            m_scripts[i]->UpdateMap(map, diff);
+}
@@ -25,7 +25,8 @@
 
 enum
 {
-    TIMER_OPVP_MGR_UPDATE           = MINUTE * IN_MILLISECONDS // 1 minute is enough for us but this might change with wintergrasp support
+    TIMER_OPVP_MGR_UPDATE           = MINUTE * IN_MILLISECONDS, // 1 minute is enough for us but this might change with wintergrasp support
+    OPVP_MAP_NONE                   = 0xFFFFFFFF                // script zone not found in dbc
 };
 
 enum OutdoorPvPTypes
@@ -69,6 +70,7 @@ class Player;
 class GameObject;
 class Creature;
 class OutdoorPvP;
+class Map;
 
 typedef std::map<uint32 /*capture point entry*/, CapturePointSlider /*slider value and lock state*/> CapturePointSliderMap;
 
@@ -92,6 +94,9 @@ class OutdoorPvPMgr
 
         void Update(uint32 diff);
 
+        // called from Map::Update, runs map bound part of scripts located at this map
+        void UpdateMap(Map* map, uint32 diff);
+
         // Save and load capture point slider
         CapturePointSliderMap const* GetCapturePointSliderMap() const { return &m_capturePointSlider; }
         void SetCapturePointSlider(uint32 entry, CapturePointSlider value) { m_capturePointSlider[entry] = value; }
@@ -103,6 +108,9 @@ class OutdoorPvPMgr
         // contains all outdoor pvp scripts
         OutdoorPvP* m_scripts[MAX_OPVP_ID];
 
+        // map of the main zone of each script
+        uint32 m_scriptMapIds[MAX_OPVP_ID];
+
         CapturePointSliderMap m_capturePointSlider;
 
         // update interval
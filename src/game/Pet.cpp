@@ -27,6 +27,7 @@
 #include "CreatureAI.h"
 #include "Unit.h"
 #include "Util.h"
+#include "CharacterEnumCache.h"
 
 // numbers represent minutes * 100 while happy (you get 100 loyalty points per min while happy)
 uint32 const LevelUpLoyalty[6] =
@@ -97,30 +98,28 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
 
     uint32 ownerid = owner->GetGUIDLow();
 
-    QueryResult* result;
-
+    // select pet by owner's pet roster, without DB lookup if owner has no such pet
     if (petnumber)
-        // known petnumber entry                  0   1      2      3        4      5    6           7              8        9           10    11    12       13         14       15            16      17              18        19                 20                 21              22
-        result = CharacterDatabase.PQuery("SELECT id, entry, owner, modelid, level, exp, Reactstate, loyaltypoints, loyalty, trainpoint, slot, name, renamed, curhealth, curmana, curhappiness, abdata, TeachSpelldata, savetime, resettalents_cost, resettalents_time, CreatedBySpell, PetType "
-                                          "FROM character_pet WHERE owner = '%u' AND id = '%u'",
-                                          ownerid, petnumber);
+    {
+        // known petnumber entry
+        if (!owner->GetPetRosterEntry(petnumber))
+            return false;
+    }
     else if (current)
-        // current pet (slot 0)                   0   1      2      3        4      5    6           7              8        9           10    11    12       13         14       15            16      17              18        19                 20                 21              22
-        result = CharacterDatabase.PQuery("SELECT id, entry, owner, modelid, level, exp, Reactstate, loyaltypoints, loyalty, trainpoint, slot, name, renamed, curhealth, curmana, curhappiness, abdata, TeachSpelldata, savetime, resettalents_cost, resettalents_time, CreatedBySpell, PetType "
-                                          "FROM character_pet WHERE owner = '%u' AND slot = '%u'",
-                                          ownerid, PET_SAVE_AS_CURRENT);
-    else if (petentry)
-        // known petentry entry (unique for summoned pet, but non unique for hunter pet (only from current or not stabled pets)
-        //                                        0   1      2      3        4      5    6           7              8        9           10    11    12       13         14       15            16      17              18        19                 20                 21              22
-        result = CharacterDatabase.PQuery("SELECT id, entry, owner, modelid, level, exp, Reactstate, loyaltypoints, loyalty, trainpoint, slot, name, renamed, curhealth, curmana, curhappiness, abdata, TeachSpelldata, savetime, resettalents_cost, resettalents_time, CreatedBySpell, PetType "
-                                          "FROM character_pet WHERE owner = '%u' AND entry = '%u' AND (slot = '%u' OR slot > '%u') ",
-                                          ownerid, petentry, PET_SAVE_AS_CURRENT, PET_SAVE_LAST_STABLE_SLOT);
+        // current pet (slot 0)
+        petnumber = owner->GetPetRosterCurrentNumber();
     else
-        // any current or other non-stabled pet (for hunter "call pet")
-        //                                        0   1      2      3        4      5    6           7              8        9           10    11    12       13         14       15            16      17              18        19                 20                 21              22
-        result = CharacterDatabase.PQuery("SELECT id, entry, owner, modelid, level, exp, Reactstate, loyaltypoints, loyalty, trainpoint, slot, name, renamed, curhealth, curmana, curhappiness, abdata, TeachSpelldata, savetime, resettalents_cost, resettalents_time, CreatedBySpell, PetType "
-                                          "FROM character_pet WHERE owner = '%u' AND (slot = '%u' OR slot > '%u') ",
-                                          ownerid, PET_SAVE_AS_CURRENT, PET_SAVE_LAST_STABLE_SLOT);
+        // known petentry entry (unique for summoned pet, but non unique for hunter pet (only from current or not stabled pets)
+        // or any current or other non-stabled pet (for hunter "call pet")
+        petnumber = owner->GetPetRosterActiveNumber(petentry);
+
+    if (!petnumber)
+        return false;
+
+    //                                                     0   1      2      3        4      5    6           7              8        9           10    11    12       13         14       15            16      17              18        19                 20                 21              22
+    QueryResult* result = CharacterDatabase.PQuery("SELECT id, entry, owner, modelid, level, exp, Reactstate, loyaltypoints, loyalty, trainpoint, slot, name, renamed, curhealth, curmana, curhappiness, abdata, TeachSpelldata, savetime, resettalents_cost, resettalents_time, CreatedBySpell, PetType "
+                          "FROM character_pet WHERE owner = '%u' AND id = '%u'",
+                          ownerid, petnumber);
 
     if (!result)
         return false;
@@ -265,6 +264,8 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
         stmt.PExecute(uint32(PET_SAVE_AS_CURRENT), ownerid, m_charmInfo->GetPetNumber());
 
         CharacterDatabase.CommitTransaction();
+
+        owner->SetPetRosterCurrent(m_charmInfo->GetPetNumber());
     }
 
     // load action bar, if data broken will fill later by default spells.
@@ -474,12 +475,25 @@ void Pet::SavePetToDB(PetSaveMode mode)
 
         savePet.Execute();
         CharacterDatabase.CommitTransaction();
+
+        PetRosterEntry petEntry;
+        petEntry.entry = GetEntry();
+        petEntry.level = getLevel();
+        petEntry.loyalty = GetLoyaltyLevel();
+        petEntry.slot = uint32(mode);
+        petEntry.petType = uint32(getPetType());
+        petEntry.name = m_name;
+        pOwner->SavePetToRoster(m_charmInfo->GetPetNumber(), petEntry, getPetType() == HUNTER_PET);
     }
     else
     {
         RemoveAllAuras(AURA_REMOVE_BY_DELETE);
         DeleteFromDB(m_charmInfo->GetPetNumber());
+        pOwner->RemoveFromPetRoster(m_charmInfo->GetPetNumber());
     }
+
+    // current pet is shown in the character list
+    sCharacterEnumCache.InvalidateAccount(pOwner->GetSession()->GetAccountId());
 }
 
 void Pet::DeleteFromDB(uint32 guidlow, bool separate_transaction)
@@ -46,6 +46,21 @@ enum PetSaveMode
     PET_SAVE_REAGENTS          =  101                       // PET_SAVE_NOT_IN_SLOT with reagents return
 };
 
+// in memory copy of the character_pet fields used by stable and pet selection, kept in sync at pet save/delete/rename
+struct PetRosterEntry
+{
+    PetRosterEntry() : entry(0), level(0), loyalty(0), slot(PET_SAVE_NOT_IN_SLOT), petType(MAX_PET_TYPE) {}
+
+    uint32 entry;
+    uint32 level;
+    uint32 loyalty;
+    uint32 slot;
+    uint32 petType;
+    std::string name;
+};
+
+typedef std::map<uint32 /*pet number*/, PetRosterEntry> PetRoster;
+
 // There might be a lot more
 enum PetModeFlags
 {
@@ -502,6 +502,7 @@ void WorldSession::HandlePetRename(WorldPacket& recv_data)
     }
 
     pet->SetName(name);
+    _player->SetPetRosterName(pet->GetCharmInfo()->GetPetNumber(), name);
 
     if (_player->GetGroup())
         _player->SetGroupUpdateFlag(GROUP_UPDATE_FLAG_PET_NAME);
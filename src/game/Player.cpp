@@ -61,6 +61,7 @@
 #include "DBCStores.h"
 #include "SQLStorages.h"
 #include "AccountMgr.h"
+#include "CharacterEnumCache.h"
 #include "AutoAIoncharm/AutoAIoncharm.h"
 #include "WorldSession.h"
 #include <cmath>
@@ -411,6 +412,7 @@ Player::Player(WorldSession* session): Unit(), m_mover(this), m_camera(this), m_
     m_SpellModRemoveCount = 0;
 
     memset(m_items, 0, sizeof(Item*)*PLAYER_SLOTS_COUNT);
+    memset(m_usedSlotMask, 0, sizeof(m_usedSlotMask));
 
     m_social = NULL;
 
@@ -617,6 +619,7 @@ bool Player::Create(uint32 guidlow, const std::string& name, uint8 race, uint8 c
 
     for (int i = 0; i < PLAYER_SLOTS_COUNT; ++i)
         m_items[i] = NULL;
+    _ClearStorageIndex();
 
     SetLocationMapId(info->mapId);
     Relocate(info->positionX, info->positionY, info->positionZ, info->orientation);
@@ -4157,6 +4160,8 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
             sLog.outError("Player::DeleteFromDB: Unsupported delete method: %u.", charDelete_method);
     }
 
+    sCharacterEnumCache.InvalidateCharacter(playerguid);
+
     if (updateRealmChars)
         sWorld.UpdateRealmCharCount(accountId);
 }
@@ -6506,7 +6511,10 @@ uint32 Player::GetZoneIdFromDB(ObjectGuid guid)
         zone = sTerrainMgr.GetZoneId(map, posx, posy, posz);
 
         if (zone > 0)
+        {
             CharacterDatabase.PExecute("UPDATE characters SET zone='%u' WHERE guid='%u'", zone, lowguid);
+            sCharacterEnumCache.InvalidateCharacter(guid);
+        }
     }
 
     return zone;
@@ -6780,6 +6788,9 @@ void Player::_ApplyItemMods(Item* item, uint8 slot, bool apply)
 
     DETAIL_LOG("applying mods for item %u ", item->GetGUIDLow());
 
+    // item stats are recomputed once after all its bonuses are (un)applied
+    BeginStatUpdateBatch();
+
     uint32 attacktype = Player::GetAttackBySlot(slot);
     if (attacktype < MAX_ATTACK)
         _ApplyWeaponDependentAuraMods(item, WeaponAttackType(attacktype), apply);
@@ -6792,6 +6803,8 @@ void Player::_ApplyItemMods(Item* item, uint8 slot, bool apply)
     ApplyItemEquipSpell(item, apply);
     ApplyEnchantment(item, apply);
 
+    EndStatUpdateBatch();
+
 	if (slot == EQUIPMENT_SLOT_MAINHAND || slot == EQUIPMENT_SLOT_OFFHAND)
 		PaladinAttacks();
 
@@ -7232,6 +7245,8 @@ void Player::_RemoveAllItemMods()
 {
     DEBUG_LOG("_RemoveAllItemMods start.");
 
+    BeginStatUpdateBatch();
+
     for (int i = 0; i < INVENTORY_SLOT_BAG_END; ++i)
     {
         if (m_items[i])
@@ -7273,6 +7288,8 @@ void Player::_RemoveAllItemMods()
         }
     }
 
+    EndStatUpdateBatch();
+
     DEBUG_LOG("_RemoveAllItemMods complete.");
 }
 
@@ -7280,6 +7297,8 @@ void Player::_ApplyAllItemMods()
 {
     DEBUG_LOG("_ApplyAllItemMods start.");
 
+    BeginStatUpdateBatch();
+
     for (int i = 0; i < INVENTORY_SLOT_BAG_END; ++i)
     {
         if (m_items[i])
@@ -7322,6 +7341,8 @@ void Player::_ApplyAllItemMods()
         }
     }
 
+    EndStatUpdateBatch();
+
     DEBUG_LOG("_ApplyAllItemMods complete.");
 }
 
@@ -8200,6 +8221,9 @@ InventoryResult Player::CanUnequipItems(uint32 item, uint32 count) const
 
 uint32 Player::GetItemCount(uint32 item, bool inBankAlso, Item* skipItem) const
 {
+    if (!_HasStoredItemStacks(item))
+        return 0;
+
     uint32 count = 0;
     for (int i = EQUIPMENT_SLOT_START; i < INVENTORY_SLOT_ITEM_END; ++i)
     {
@@ -9742,8 +9766,22 @@ InventoryResult Player::_CanStoreItem_InBag(uint8 bag, ItemPosCountVec& dest, It
     if (!ItemCanGoIntoBag(pProto, pBagProto))
         return EQUIP_ERR_ITEM_DOESNT_GO_INTO_BAG;
 
-    for (uint32 j = 0; j < pBag->GetBagSize(); ++j)
+    // nothing to merge with
+    if (merge && !_HasStoredItemStacks(pProto->ItemId))
+        return EQUIP_ERR_OK;
+
+    // visit only non-empty slots at merge and empty slots otherwise, moved item slot will be empty at move
+    uint32 usedSlots = pBag->GetUsedSlotMask();
+    if (pSrcItem && pSrcItem->GetContainer() == pBag)
+        usedSlots &= ~(1u << pSrcItem->GetSlot());
+
+    uint32 candidates = (merge ? usedSlots : ~usedSlots) & ((1u << pBag->GetBagSize()) - 1);
+
+    for (uint32 j = 0; candidates; ++j, candidates >>= 1)
     {
+        if (!(candidates & 1))
+            continue;
+
         // skip specific slot already processed in first called _CanStoreItem_InSpecificSlot
         if (j == skip_slot)
             continue;
@@ -9787,13 +9825,47 @@ InventoryResult Player::_CanStoreItem_InBag(uint8 bag, ItemPosCountVec& dest, It
     return EQUIP_ERR_OK;
 }
 
+// returns first slot in [slot, end) with the wanted state in the used slots bitmap, end if none
+static uint32 FindStorageSlot(uint32 const* usedSlots, bool used, uint32 slot, uint32 end)
+{
+    while (slot < end)
+    {
+        uint32 word = used ? usedSlots[slot / 32] : ~usedSlots[slot / 32];
+        word >>= slot % 32;
+
+        // skip whole words without wanted slots
+        if (!word)
+        {
+            slot = (slot / 32 + 1) * 32;
+            continue;
+        }
+
+        for (; !(word & 1); word >>= 1)
+            ++slot;
+
+        return slot < end ? slot : end;
+    }
+
+    return end;
+}
+
 InventoryResult Player::_CanStoreItem_InInventorySlots(uint8 slot_begin, uint8 slot_end, ItemPosCountVec& dest, ItemPrototype const* pProto, uint32& count, bool merge, Item* pSrcItem, uint8 skip_bag, uint8 skip_slot) const
 {
 	//this is never called for non-bag slots so we can do this
     if (pSrcItem && pSrcItem->IsBag() && !((Bag*)pSrcItem)->IsEmpty())
         return EQUIP_ERR_CAN_ONLY_DO_WITH_EMPTY_BAGS;
 
-    for (uint32 j = slot_begin; j < slot_end; ++j)
+    // nothing to merge with
+    if (merge && !_HasStoredItemStacks(pProto->ItemId))
+        return EQUIP_ERR_OK;
+
+    // visit only non-empty slots at merge and empty slots otherwise, moved item slot will be empty at move
+    uint32 usedSlots[(PLAYER_SLOTS_COUNT + 31) / 32];
+    memcpy(usedSlots, m_usedSlotMask, sizeof(usedSlots));
+    if (pSrcItem && pSrcItem->GetSlot() < PLAYER_SLOTS_COUNT && m_items[pSrcItem->GetSlot()] == pSrcItem)
+        usedSlots[pSrcItem->GetSlot() / 32] &= ~(1u << (pSrcItem->GetSlot() % 32));
+
+    for (uint32 j = FindStorageSlot(usedSlots, merge, slot_begin, slot_end); j < slot_end; j = FindStorageSlot(usedSlots, merge, j + 1, slot_end))
     {
         // skip specific slot already processed in first called _CanStoreItem_InSpecificSlot
         if (INVENTORY_SLOT_BAG_0 == skip_bag && j == skip_slot)
@@ -11006,6 +11078,60 @@ Item* Player::StoreNewItem(ItemPosCountVec const& dest, uint32 item, bool update
     return pItem;
 }
 
+void Player::_AddItemToStorageIndex(uint8 bag, uint8 slot, Item* pItem)
+{
+    if (bag == INVENTORY_SLOT_BAG_0)
+    {
+        m_usedSlotMask[slot / 32] |= (1u << (slot % 32));
+
+        // bag content comes together with the bag
+        if (pItem->IsBag())
+        {
+            Bag* pBag = (Bag*)pItem;
+            for (uint32 i = 0; i < pBag->GetBagSize(); ++i)
+                if (Item* pBagItem = pBag->GetItemByPos(i))
+                    ++m_storedItemStacks[pBagItem->GetEntry()];
+        }
+    }
+
+    ++m_storedItemStacks[pItem->GetEntry()];
+}
+
+void Player::_RemoveItemFromStorageIndex(uint8 bag, uint8 slot, Item* pItem)
+{
+    std::vector<uint32> entries;
+    entries.push_back(pItem->GetEntry());
+
+    if (bag == INVENTORY_SLOT_BAG_0)
+    {
+        m_usedSlotMask[slot / 32] &= ~(1u << (slot % 32));
+
+        if (pItem->IsBag())
+        {
+            Bag* pBag = (Bag*)pItem;
+            for (uint32 i = 0; i < pBag->GetBagSize(); ++i)
+                if (Item* pBagItem = pBag->GetItemByPos(i))
+                    entries.push_back(pBagItem->GetEntry());
+        }
+    }
+
+    for (std::vector<uint32>::const_iterator itr = entries.begin(); itr != entries.end(); ++itr)
+    {
+        ItemEntryStackMap::iterator stackItr = m_storedItemStacks.find(*itr);
+        if (stackItr == m_storedItemStacks.end())
+            continue;
+
+        if (--stackItr->second == 0)
+            m_storedItemStacks.erase(stackItr);
+    }
+}
+
+void Player::_ClearStorageIndex()
+{
+    memset(m_usedSlotMask, 0, sizeof(m_usedSlotMask));
+    m_storedItemStacks.clear();
+}
+
 Item* Player::StoreItem(ItemPosCountVec const& dest, Item* pItem, bool update)
 {
     if (!pItem)
@@ -11066,6 +11192,7 @@ Item* Player::_StoreItem(uint16 pos, Item* pItem, uint32 count, bool clone, bool
         if (bag == INVENTORY_SLOT_BAG_0)
         {
             m_items[slot] = pItem;
+            _AddItemToStorageIndex(bag, slot, pItem);
             SetGuidValue(PLAYER_FIELD_INV_SLOT_HEAD + (slot * 2), pItem->GetObjectGuid());
             pItem->SetGuidValue(ITEM_FIELD_CONTAINED, GetObjectGuid());
             pItem->SetGuidValue(ITEM_FIELD_OWNER, GetObjectGuid());
@@ -11084,6 +11211,7 @@ Item* Player::_StoreItem(uint16 pos, Item* pItem, uint32 count, bool clone, bool
         else if (Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, bag))
         {
             pBag->StoreItem(slot, pItem);
+            _AddItemToStorageIndex(bag, slot, pItem);
             if (IsInWorld() && update)
             {
                 pItem->AddToWorld();
@@ -11296,6 +11424,7 @@ void Player::VisualizeItem(uint8 slot, Item* pItem)
     DEBUG_LOG("STORAGE: EquipItem slot = %u, item = %u", slot, pItem->GetEntry());
 
     m_items[slot] = pItem;
+    _AddItemToStorageIndex(INVENTORY_SLOT_BAG_0, slot, pItem);
     SetGuidValue(PLAYER_FIELD_INV_SLOT_HEAD + (slot * 2), pItem->GetObjectGuid());
     pItem->SetGuidValue(ITEM_FIELD_CONTAINED, GetObjectGuid());
     pItem->SetGuidValue(ITEM_FIELD_OWNER, GetObjectGuid());
@@ -11346,6 +11475,7 @@ void Player::RemoveItem(uint8 bag, uint8 slot, bool update)
                 }
             }
 
+            _RemoveItemFromStorageIndex(bag, slot, pItem);
             m_items[slot] = NULL;
             SetGuidValue(PLAYER_FIELD_INV_SLOT_HEAD + (slot * 2), ObjectGuid());
 
@@ -11356,7 +11486,10 @@ void Player::RemoveItem(uint8 bag, uint8 slot, bool update)
         {
             Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, bag);
             if (pBag)
+            {
+                _RemoveItemFromStorageIndex(bag, slot, pItem);
                 pBag->RemoveItem(slot);
+            }
         }
         pItem->SetGuidValue(ITEM_FIELD_CONTAINED, ObjectGuid());
         // pItem->SetGuidValue(ITEM_FIELD_OWNER, ObjectGuid()); not clear owner at remove (it will be set at store). This used in mail and auction code
@@ -11456,10 +11589,14 @@ void Player::DestroyItem(uint8 bag, uint8 slot, bool update)
                 SetVisibleItemSlot(slot, NULL);
             }
 
+            _RemoveItemFromStorageIndex(bag, slot, pItem);
             m_items[slot] = NULL;
         }
         else if (Bag* pBag = (Bag*)GetItemByPos(INVENTORY_SLOT_BAG_0, bag))
+        {
+            _RemoveItemFromStorageIndex(bag, slot, pItem);
             pBag->RemoveItem(slot);
+        }
 
         if (IsInWorld() && update)
         {
@@ -12123,6 +12260,7 @@ void Player::AddItemToBuyBackSlot(Item* pItem)
         DEBUG_LOG("STORAGE: AddItemToBuyBackSlot item = %u, slot = %u", pItem->GetEntry(), slot);
 
         m_items[slot] = pItem;
+        _AddItemToStorageIndex(INVENTORY_SLOT_BAG_0, slot, pItem);
         time_t base = time(NULL);
         uint32 etime = uint32(base - m_logintime + (30 * 3600));
         uint32 eslot = slot - BUYBACK_SLOT_START;
@@ -12158,6 +12296,8 @@ void Player::RemoveItemFromBuyBackSlot(uint32 slot, bool del)
         {
             pItem->RemoveFromWorld();
             if (del) pItem->SetState(ITEM_REMOVED, this);
+
+            _RemoveItemFromStorageIndex(INVENTORY_SLOT_BAG_0, slot, pItem);
         }
 
         m_items[slot] = NULL;
@@ -14297,6 +14437,35 @@ void Player::AdjustQuestReqItemCount(Quest const* pQuest, QuestStatusData& quest
     }
 }
 
+void Player::RebuildQuestObjectiveIndex()
+{
+    m_questObjectiveTargets.clear();
+    m_questObjectiveItems.clear();
+
+    for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
+    {
+        uint32 questid = GetQuestSlotQuestId(i);
+        if (!questid)
+            continue;
+
+        Quest const* qInfo = sObjectMgr.GetQuestTemplate(questid);
+        if (!qInfo)
+            continue;
+
+        for (int j = 0; j < QUEST_OBJECTIVES_COUNT; ++j)
+            if (qInfo->ReqCreatureOrGOId[j])
+                m_questObjectiveTargets.insert(qInfo->ReqCreatureOrGOId[j]);
+
+        for (int j = 0; j < QUEST_ITEM_OBJECTIVES_COUNT; ++j)
+            if (qInfo->ReqItemId[j])
+                m_questObjectiveItems.insert(qInfo->ReqItemId[j]);
+
+        for (int j = 0; j < QUEST_SOURCE_ITEM_IDS_COUNT; ++j)
+            if (qInfo->ReqSourceId[j])
+                m_questObjectiveItems.insert(qInfo->ReqSourceId[j]);
+    }
+}
+
 uint16 Player::FindQuestSlot(uint32 quest_id) const
 {
     for (uint16 i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
@@ -14350,6 +14519,12 @@ void Player::GroupEventHappens(uint32 questId, WorldObject const* pEventObject)
 
 void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 {
+    if (m_questObjectiveItems.find(entry) == m_questObjectiveItems.end())
+    {
+        UpdateForQuestWorldObjects();
+        return;
+    }
+
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         uint32 questid = GetQuestSlotQuestId(i);
@@ -14392,6 +14567,12 @@ void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 
 void Player::ItemRemovedQuestCheck(uint32 entry, uint32 count)
 {
+    if (m_questObjectiveItems.find(entry) == m_questObjectiveItems.end())
+    {
+        UpdateForQuestWorldObjects();
+        return;
+    }
+
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         uint32 questid = GetQuestSlotQuestId(i);
@@ -14443,6 +14624,9 @@ void Player::KilledMonster(CreatureInfo const* cInfo, ObjectGuid guid)
 
 void Player::KilledMonsterCredit(uint32 entry, ObjectGuid guid)
 {
+    if (m_questObjectiveTargets.find(int32(entry)) == m_questObjectiveTargets.end())
+        return;
+
     uint32 addkillcount = 1;
 
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
@@ -14501,6 +14685,9 @@ void Player::CastedCreatureOrGO(uint32 entry, ObjectGuid guid, uint32 spell_id,
 {
     bool isCreature = guid.IsCreature();
 
+    if (m_questObjectiveTargets.find(isCreature ? int32(entry) : -int32(entry)) == m_questObjectiveTargets.end())
+        return;
+
     uint32 addCastCount = 1;
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
@@ -14572,6 +14759,9 @@ void Player::CastedCreatureOrGO(uint32 entry, ObjectGuid guid, uint32 spell_id,
 
 void Player::TalkedToCreature(uint32 entry, ObjectGuid guid)
 {
+    if (m_questObjectiveTargets.find(int32(entry)) == m_questObjectiveTargets.end())
+        return;
+
     uint32 addTalkCount = 1;
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
@@ -14686,6 +14876,9 @@ void Player::ReputationChanged(FactionEntry const* factionEntry)
 
 bool Player::HasQuestForItem(uint32 itemid) const
 {
+    if (m_questObjectiveItems.find(itemid) == m_questObjectiveItems.end())
+        return false;
+
     for (int i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         uint32 questid = GetQuestSlotQuestId(i);
@@ -14984,6 +15177,7 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
         delete result;
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid ='%u'",
                                    uint32(AT_LOGIN_RENAME), guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(guid);      // client must see the rename request
         return false;
     }
 
@@ -15341,6 +15535,8 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
     _LoadMailedItems(holder->GetResult(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS));
     UpdateNextMailTimeAndUnreads();
 
+    _LoadPetRoster(holder->GetResult(PLAYER_LOGIN_QUERY_LOADPETS));
+
     _LoadAuras(holder->GetResult(PLAYER_LOGIN_QUERY_LOADAURAS), time_diff);
 
     // add ghost flag (must be after aura load: PLAYER_FLAGS_GHOST set in aura)
@@ -16162,6 +16358,113 @@ void Player::LoadPet()
     }
 }
 
+void Player::_LoadPetRoster(QueryResult* result)
+{
+    m_petRoster.clear();
+    //        0   1      2      3        4     5     6
+    //"SELECT id, entry, level, loyalty, slot, name, PetType FROM character_pet WHERE owner = '%u'", GetGUIDLow()
+    if (!result)
+        return;
+
+    do
+    {
+        Field* fields = result->Fetch();
+
+        PetRosterEntry& petEntry = m_petRoster[fields[0].GetUInt32()];
+        petEntry.entry = fields[1].GetUInt32();
+        petEntry.level = fields[2].GetUInt32();
+        petEntry.loyalty = fields[3].GetUInt32();
+        petEntry.slot = fields[4].GetUInt32();
+        petEntry.name = fields[5].GetCppString();
+        petEntry.petType = fields[6].GetUInt32();
+    }
+    while (result->NextRow());
+    delete result;
+}
+
+PetRosterEntry const* Player::GetPetRosterEntry(uint32 petNumber) const
+{
+    PetRoster::const_iterator itr = m_petRoster.find(petNumber);
+    return itr != m_petRoster.end() ? &itr->second : NULL;
+}
+
+uint32 Player::GetPetRosterActiveNumber(uint32 entry) const
+{
+    for (PetRoster::const_iterator itr = m_petRoster.begin(); itr != m_petRoster.end(); ++itr)
+    {
+        if (itr->second.slot != PET_SAVE_AS_CURRENT && itr->second.slot <= PET_SAVE_LAST_STABLE_SLOT)
+            continue;
+
+        if (!entry || itr->second.entry == entry)
+            return itr->first;
+    }
+
+    return 0;
+}
+
+uint32 Player::GetPetRosterCurrentNumber() const
+{
+    for (PetRoster::const_iterator itr = m_petRoster.begin(); itr != m_petRoster.end(); ++itr)
+        if (itr->second.slot == PET_SAVE_AS_CURRENT)
+            return itr->first;
+
+    return 0;
+}
+
+uint32 Player::GetPetRosterFreeStableSlot() const
+{
+    bool used[PET_SAVE_LAST_STABLE_SLOT + 1] = { false };
+
+    for (PetRoster::const_iterator itr = m_petRoster.begin(); itr != m_petRoster.end(); ++itr)
+        if (itr->second.slot >= PET_SAVE_FIRST_STABLE_SLOT && itr->second.slot <= PET_SAVE_LAST_STABLE_SLOT)
+            used[itr->second.slot] = true;
+
+    for (uint32 slot = PET_SAVE_FIRST_STABLE_SLOT; slot <= PET_SAVE_LAST_STABLE_SLOT; ++slot)
+        if (!used[slot])
+            return slot;
+
+    return 0;
+}
+
+void Player::SavePetToRoster(uint32 petNumber, PetRosterEntry const& petEntry, bool hunterPet)
+{
+    m_petRoster.erase(petNumber);
+
+    for (PetRoster::iterator itr = m_petRoster.begin(); itr != m_petRoster.end();)
+    {
+        // prevent duplicate using slot (except PET_SAVE_NOT_IN_SLOT)
+        if (petEntry.slot <= PET_SAVE_LAST_STABLE_SLOT && itr->second.slot == petEntry.slot)
+            itr->second.slot = PET_SAVE_NOT_IN_SLOT;
+
+        // prevent existence another hunter pet in PET_SAVE_AS_CURRENT and PET_SAVE_NOT_IN_SLOT
+        if (hunterPet && (petEntry.slot == PET_SAVE_AS_CURRENT || petEntry.slot > PET_SAVE_LAST_STABLE_SLOT) &&
+                (itr->second.slot == PET_SAVE_AS_CURRENT || itr->second.slot > PET_SAVE_LAST_STABLE_SLOT))
+            m_petRoster.erase(itr++);
+        else
+            ++itr;
+    }
+
+    m_petRoster[petNumber] = petEntry;
+}
+
+void Player::SetPetRosterCurrent(uint32 petNumber)
+{
+    for (PetRoster::iterator itr = m_petRoster.begin(); itr != m_petRoster.end(); ++itr)
+    {
+        if (itr->first == petNumber)
+            itr->second.slot = PET_SAVE_AS_CURRENT;
+        else if (itr->second.slot == PET_SAVE_AS_CURRENT)
+            itr->second.slot = PET_SAVE_NOT_IN_SLOT;
+    }
+}
+
+void Player::SetPetRosterName(uint32 petNumber, std::string const& name)
+{
+    PetRoster::iterator itr = m_petRoster.find(petNumber);
+    if (itr != m_petRoster.end())
+        itr->second.name = name;
+}
+
 void Player::_LoadQuestStatus(QueryResult* result)
 {
     mQuestStatus.clear();
@@ -16816,6 +17119,8 @@ void Player::SaveToDB()
 
     CharacterDatabase.CommitTransaction();
 
+    sCharacterEnumCache.InvalidateAccount(GetSession()->GetAccountId());
+
     // check if stats should only be saved on logout
     // save stats can be out of transaction
     if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
@@ -17438,6 +17743,7 @@ void Player::SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, f
        << "transguid='0',taxi_path='' WHERE guid='" << guid.GetCounter() << "'";
     DEBUG_LOG("%s", ss.str().c_str());
     CharacterDatabase.Execute(ss.str().c_str());
+    sCharacterEnumCache.InvalidateCharacter(guid);
 }
 
 void Player::SetUInt32ValueInArray(Tokens& tokens, uint16 index, uint32 value)
@@ -22398,7 +22704,10 @@ void Player::RemoveAtLoginFlag(AtLoginFlags f, bool in_db_also /*= false*/)
     m_atLoginFlags &= ~f;
 
     if (in_db_also)
+    {
         CharacterDatabase.PExecute("UPDATE characters set at_login = at_login & ~ %u WHERE guid ='%u'", uint32(f), GetGUIDLow());
+        sCharacterEnumCache.InvalidateCharacter(GetObjectGuid());
+    }
 }
 
 void Player::SendClearCooldown(uint32 spell_id, Unit* target)
@@ -720,6 +720,7 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOADSKILLS,
     PLAYER_LOGIN_QUERY_LOADMAILS,
     PLAYER_LOGIN_QUERY_LOADMAILEDITEMS,
+    PLAYER_LOGIN_QUERY_LOADPETS,
 
     MAX_PLAYER_LOGIN_QUERY
 };
@@ -1268,6 +1269,21 @@ class MANGOS_DLL_SPEC Player : public Unit
 
         uint32 m_stableSlots;
 
+        PetRoster const& GetPetRoster() const { return m_petRoster; }
+        PetRosterEntry const* GetPetRosterEntry(uint32 petNumber) const;
+        // pet number of current or not stabled pet, optionally with required entry, 0 if not exist
+        uint32 GetPetRosterActiveNumber(uint32 entry = 0) const;
+        // pet number of current pet, 0 if not exist
+        uint32 GetPetRosterCurrentNumber() const;
+        // first stable slot without pet, 0 if all slots used
+        uint32 GetPetRosterFreeStableSlot() const;
+        // mirror the slot changes done by Pet::SavePetToDB
+        void SavePetToRoster(uint32 petNumber, PetRosterEntry const& petEntry, bool hunterPet);
+        // mirror the slot changes done at pet load as current
+        void SetPetRosterCurrent(uint32 petNumber);
+        void SetPetRosterName(uint32 petNumber, std::string const& name);
+        void RemoveFromPetRoster(uint32 petNumber) { m_petRoster.erase(petNumber); }
+
         /*********************************************************/
         /***                    GOSSIP SYSTEM                  ***/
         /*********************************************************/
@@ -1330,12 +1346,15 @@ class MANGOS_DLL_SPEC Player : public Unit
         void SetQuestStatus(uint32 quest_id, QuestStatus status);
 
         uint16 FindQuestSlot(uint32 quest_id) const;
+        // must be called at quest log content or quest template changes
+        void RebuildQuestObjectiveIndex();
         uint32 GetQuestSlotQuestId(uint16 slot) const { return GetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_ID_OFFSET); }
         void SetQuestSlot(uint16 slot, uint32 quest_id, uint32 timer = 0)
         {
             SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_ID_OFFSET, quest_id);
             SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNT_STATE_OFFSET, 0);
             SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_TIME_OFFSET, timer);
+            RebuildQuestObjectiveIndex();
         }
         void SetQuestSlotCounter(uint16 slot, uint8 counter, uint8 count)
         {
@@ -2292,6 +2311,7 @@ class MANGOS_DLL_SPEC Player : public Unit
 		uint32 GetDaysTime(uint32 time, uint32 chanshu);
 
     protected:
+        void UpdateStatGroup(uint32 group) override;
 
         uint32 m_contestedPvPTimer;
 
@@ -2334,6 +2354,7 @@ class MANGOS_DLL_SPEC Player : public Unit
         void _LoadItemLoot(QueryResult* result);
         void _LoadMails(QueryResult* result);
         void _LoadMailedItems(QueryResult* result);
+        void _LoadPetRoster(QueryResult* result);
         void _LoadQuestStatus(QueryResult* result);
         void _LoadGroup(QueryResult* result);
         void _LoadSkills(QueryResult* result);
@@ -2396,6 +2417,11 @@ class MANGOS_DLL_SPEC Player : public Unit
         Item* m_items[PLAYER_SLOTS_COUNT];
         uint32 m_currentBuybackSlot;
 
+        // storage summary kept in sync with m_items and the bags stored in it, used to skip slot scans at CanStore checks
+        typedef UNORDERED_MAP<uint32, uint32> ItemEntryStackMap;
+        uint32 m_usedSlotMask[(PLAYER_SLOTS_COUNT + 31) / 32];  // bit per non empty m_items slot
+        ItemEntryStackMap m_storedItemStacks;               // item entry -> stacks stored in m_items and its bags
+
         std::vector<Item*> m_itemUpdateQueue;
         bool m_itemUpdateQueueBlocked;
 
@@ -2407,6 +2433,12 @@ class MANGOS_DLL_SPEC Player : public Unit
 
         QuestStatusMap mQuestStatus;
 
+        // objective targets of the quests in the quest log, credit checks for other entries skip the quest log scan
+        typedef UNORDERED_SET<int32> QuestObjectiveTargetSet;
+        typedef UNORDERED_SET<uint32> QuestObjectiveItemSet;
+        QuestObjectiveTargetSet m_questObjectiveTargets;    // ReqCreatureOrGOId, >0 creature <0 gameobject
+        QuestObjectiveItemSet m_questObjectiveItems;        // ReqItemId and ReqSourceId
+
         SkillStatusMap mSkillStatus;
 
         uint32 m_GuildIdInvited;
@@ -2513,6 +2545,12 @@ class MANGOS_DLL_SPEC Player : public Unit
         InventoryResult _CanStoreItem_InInventorySlots(uint8 slot_begin, uint8 slot_end, ItemPosCountVec& dest, ItemPrototype const* pProto, uint32& count, bool merge, Item* pSrcItem, uint8 skip_bag, uint8 skip_slot) const;
         Item* _StoreItem(uint16 pos, Item* pItem, uint32 count, bool clone, bool update);
 
+        // must be called for every item put to or taken from m_items or a bag stored there
+        void _AddItemToStorageIndex(uint8 bag, uint8 slot, Item* pItem);
+        void _RemoveItemFromStorageIndex(uint8 bag, uint8 slot, Item* pItem);
+        void _ClearStorageIndex();
+        bool _HasStoredItemStacks(uint32 entry) const { return m_storedItemStacks.find(entry) != m_storedItemStacks.end(); }
+
         void UpdateKnownCurrencies(uint32 itemId, bool apply);
         void AdjustQuestReqItemCount(Quest const* pQuest, QuestStatusData& questStatusData);
 
@@ -2576,6 +2614,7 @@ class MANGOS_DLL_SPEC Player : public Unit
 
         // Temporary removed pet cache
         uint32 m_temporaryUnsummonedPetNumber;
+        PetRoster m_petRoster;
 
         ReputationMgr  m_reputationMgr;
 
@@ -23,6 +23,7 @@
 #include "UpdateFields.h"
 #include "ObjectMgr.h"
 #include "AccountMgr.h"
+#include "CharacterEnumCache.h"
 
 // Character Dump tables
 struct DumpTable
@@ -272,8 +273,20 @@ void StoreGUID(QueryResult* result, uint32 data, uint32 field, std::set<uint32>&
         guids.insert(guid);
 }
 
+// dump content is written to file in chunks of about this size
+#define DUMP_WRITE_CHUNK_SIZE (64*1024)
+
+static void FlushDump(std::string& dump, FILE* fout)
+{
+    if (!fout || dump.empty())
+        return;
+
+    fwrite(dump.c_str(), 1, dump.size(), fout);
+    dump.clear();
+}
+
 // Writing - High-level functions
-void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type)
+void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type, FILE* fout)
 {
     GUIDs const* guids = NULL;
     char const* fieldname = NULL;
@@ -335,6 +348,9 @@ void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char con
 
             dump += CreateDumpString(tableTo, result);
             dump += "\n";
+
+            if (dump.size() >= DUMP_WRITE_CHUNK_SIZE)
+                FlushDump(dump, fout);
         }
         while (result->NextRow());
 
@@ -343,10 +359,8 @@ void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char con
     while (guids && guids_itr != guids->end());             // not set case iterate single time, set case iterate for all guids
 }
 
-std::string PlayerDumpWriter::GetDump(uint32 guid)
+void PlayerDumpWriter::DumpHeader(std::string& dump)
 {
-    std::string dump;
-
     dump += "IMPORTANT NOTE: This sql queries not created for apply directly, use '.pdump load' command in console or client chat instead.\n";
     dump += "IMPORTANT NOTE: NOT APPLY ITS DIRECTLY to character DB or you will DAMAGE and CORRUPT character DB\n\n";
 
@@ -377,31 +391,103 @@ std::string PlayerDumpWriter::GetDump(uint32 guid)
     }
     else
         sLog.outError("Character DB not have 'character_db_version' table, revision guard query not added to pdump.");
+}
+
+void PlayerDumpWriter::DumpCharacter(std::string& dump, uint32 guid, FILE* fout)
+{
+    // collected guids are per character
+    pets.clear();
+    mails.clear();
+    items.clear();
+    texts.clear();
 
     for (DumpTable* itr = &dumpTables[0]; itr->isValid(); ++itr)
-        DumpTableContent(dump, guid, itr->name, itr->name, itr->type);
+        DumpTableContent(dump, guid, itr->name, itr->name, itr->type, fout);
 
     // TODO: Add instance/group..
     // TODO: Add a dump level option to skip some non-important tables
+}
+
+std::string PlayerDumpWriter::GetDump(uint32 guid)
+{
+    std::string dump;
+
+    DumpHeader(dump);
+    DumpCharacter(dump, guid, NULL);
 
     return dump;
 }
 
 DumpReturn PlayerDumpWriter::WriteDump(const std::string& file, uint32 guid)
+{
+    return WriteDump(file, std::vector<uint32>(1, guid));
+}
+
+DumpReturn PlayerDumpWriter::WriteDump(const std::string& file, std::vector<uint32> const& guids)
 {
     FILE* fout = fopen(file.c_str(), "w");
     if (!fout)
         return DUMP_FILE_OPEN_ERROR;
 
-    std::string dump = GetDump(guid);
+    std::string dump;
+    dump.reserve(DUMP_WRITE_CHUNK_SIZE * 2);
+
+    // the load of a character listed twice would insert the same item/mail/pet rows twice
+    std::set<uint32> written;
+
+    DumpHeader(dump);
+    for (std::vector<uint32>::const_iterator itr = guids.begin(); itr != guids.end(); ++itr)
+        if (written.insert(*itr).second)
+            DumpCharacter(dump, *itr, fout);
+
+    dump += "\n";
+    FlushDump(dump, fout);
 
-    fprintf(fout, "%s\n", dump.c_str());
     fclose(fout);
     return DUMP_SUCCESS;
 }
 
 // Reading - High-level functions
-#define ROLLBACK(DR) {CharacterDatabase.RollbackTransaction(); fclose(fin); return (DR);}
+#define ROLLBACK(DR) {m_insertSql.clear(); m_insertTable.clear(); CharacterDatabase.RollbackTransaction(); fclose(fin); return (DR);}
+
+// dumped rows of the same table are applied as one multi-row insert
+bool PlayerDumpReader::AddInsert(std::string const& line, std::string const& table)
+{
+    // INSERT INTO `table` VALUES (...);
+    std::string::size_type s = line.find("VALUES (");
+    std::string::size_type e = line.rfind(')');
+    if (s == std::string::npos || e == std::string::npos || e < s)
+        return false;
+
+    s += 7;                                                 // keep the opening bracket
+    if (table != m_insertTable || m_insertSql.size() + (e - s) + 2 > MAX_QUERY_LEN)
+    {
+        if (!FlushInserts())
+            return false;
+    }
+
+    if (m_insertSql.empty())
+    {
+        m_insertTable = table;
+        m_insertSql.assign(line, 0, s);
+    }
+    else
+        m_insertSql += ",";
+
+    m_insertSql.append(line, s, e - s + 1);
+    return true;
+}
+
+bool PlayerDumpReader::FlushInserts()
+{
+    if (m_insertSql.empty())
+        return true;
+
+    bool res = CharacterDatabase.Execute(m_insertSql.c_str());
+    m_insertSql.clear();
+    m_insertTable.clear();
+    return res;
+}
 
 DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, std::string name, uint32 guid)
 {
@@ -465,6 +551,10 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
     typedef PetIds::value_type PetIdsPair;
     PetIds petids;
 
+    uint32 loadedChars = 0;                                 // characters already read from a bulk dump
+    std::set<uint32> loadedCharGuids;                       // guids in the dump, item/mail/pet guid maps are shared by all characters
+    uint32 newHighestGuids = incHighest ? 1 : 0;            // character guids taken above the highest used
+
     CharacterDatabase.BeginTransaction();
     while (!feof(fin))
     {
@@ -488,7 +578,7 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
         // add required_ check
         if (line.substr(nw_pos, 41) == "UPDATE character_db_version SET required_")
         {
-            if (!CharacterDatabase.Execute(line.c_str()))
+            if (!FlushInserts() || !CharacterDatabase.Execute(line.c_str()))
                 ROLLBACK(DUMP_FILE_BROKEN);
 
             continue;
@@ -529,6 +619,25 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
 
             case DTT_CHARACTER:
             {
+                // the same character twice would fail at commit on duplicate keys, after success was already reported
+                uint32 oldGuid = atoi(getnth(line, 1).c_str());
+                if (!loadedCharGuids.insert(oldGuid).second)
+                {
+                    sLog.outError("LoadPlayerDump: Character %u is contained more than once!", oldGuid);
+                    ROLLBACK(DUMP_FILE_BROKEN);
+                }
+
+                // next character of a bulk dump, name and guid from arguments belong to the first one
+                if (loadedChars++)
+                {
+                    if (charcount + loadedChars > 10)
+                        ROLLBACK(DUMP_TOO_MANY_CHARS);
+
+                    snprintf(newguid, 20, "%u", sObjectMgr.m_CharGuids.GetNextAfterMaxUsed() + newHighestGuids);
+                    ++newHighestGuids;
+                    name.clear();
+                }
+
                 if (!changenth(line, 1, newguid))           // characters.guid update
                     ROLLBACK(DUMP_FILE_BROKEN);
 
@@ -684,19 +793,24 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
                 break;
         }
 
-        if (!CharacterDatabase.Execute(line.c_str()))
+        if (!AddInsert(line, tn))
             ROLLBACK(DUMP_FILE_BROKEN);
     }
 
+    if (!FlushInserts())
+        ROLLBACK(DUMP_FILE_BROKEN);
+
     CharacterDatabase.CommitTransaction();
 
+    sCharacterEnumCache.InvalidateAccount(account);
+
     // FIXME: current code with post-updating guids not safe for future per-map threads
     sObjectMgr.m_ItemGuids.Set(sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed() + items.size());
     sObjectMgr.m_MailIds.Set(sObjectMgr.m_MailIds.GetNextAfterMaxUsed() +  mails.size());
     sObjectMgr.m_ItemTextIds.Set(sObjectMgr.m_ItemTextIds.GetNextAfterMaxUsed() + itemTexts.size());
 
-    if (incHighest)
-        sObjectMgr.m_CharGuids.Set(sObjectMgr.m_CharGuids.GetNextAfterMaxUsed() + 1);
+    if (newHighestGuids)
+        sObjectMgr.m_CharGuids.Set(sObjectMgr.m_CharGuids.GetNextAfterMaxUsed() + newHighestGuids);
 
     fclose(fin);
 
@@ -22,6 +22,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 
 enum DumpTableType
 {
@@ -74,10 +75,15 @@ class PlayerDumpWriter : public PlayerDump
 
         std::string GetDump(uint32 guid);
         DumpReturn WriteDump(const std::string& file, uint32 guid);
+        // bulk mode, all characters are written to one file that is loaded by a single LoadDump
+        DumpReturn WriteDump(const std::string& file, std::vector<uint32> const& guids);
     private:
         typedef std::set<uint32> GUIDs;
 
-        void DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type);
+        void DumpHeader(std::string& dump);
+        void DumpCharacter(std::string& dump, uint32 guid, FILE* fout);
+        // with fout set, the dump is written to file and cleared whenever it grows large
+        void DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type, FILE* fout);
         std::string GenerateWhereStr(char const* field, GUIDs const& guids, GUIDs::const_iterator& itr);
         std::string GenerateWhereStr(char const* field, uint32 guid);
 
@@ -92,7 +98,15 @@ class PlayerDumpReader : public PlayerDump
     public:
         PlayerDumpReader() {}
 
+        // name and guid are used for the first character of the dump only
         DumpReturn LoadDump(const std::string& file, uint32 account, std::string name, uint32 guid);
+
+    private:
+        bool AddInsert(std::string const& line, std::string const& table);
+        bool FlushInserts();
+
+        std::string m_insertTable;                          // table of the pending multi-row insert
+        std::string m_insertSql;                            // pending multi-row insert
 };
 
 #endif
@@ -66,6 +66,9 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friend_guid, bool ignore)
     if (ignore)
         flag = SOCIAL_FLAG_IGNORED;
 
+    if (flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr.AddFriendLister(friend_guid.GetCounter(), m_playerLowGuid);
+
     PlayerSocialMap::const_iterator itr = m_playerSocialMap.find(friend_guid.GetCounter());
     if (itr != m_playerSocialMap.end())
     {
@@ -92,6 +95,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid friend_guid, bool ignore)
     if (ignore)
         flag = SOCIAL_FLAG_IGNORED;
 
+    if (itr->second.Flags & flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr.RemoveFriendLister(friend_guid.GetCounter(), m_playerLowGuid);
+
     itr->second.Flags &= ~flag;
     if (itr->second.Flags == 0)
     {
@@ -184,6 +190,34 @@ SocialMgr::~SocialMgr()
 {
 }
 
+void SocialMgr::RemovePlayerSocial(uint32 guid)
+{
+    SocialMap::iterator itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    RemoveFriendListers(itr->second);
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::RemoveFriendLister(uint32 friend_guid, uint32 lister_guid)
+{
+    FriendListersMap::iterator itr = m_friendListers.find(friend_guid);
+    if (itr == m_friendListers.end())
+        return;
+
+    itr->second.erase(lister_guid);
+    if (itr->second.empty())
+        m_friendListers.erase(itr);
+}
+
+void SocialMgr::RemoveFriendListers(PlayerSocial const& social)
+{
+    for (PlayerSocialMap::const_iterator itr = social.m_playerSocialMap.begin(); itr != social.m_playerSocialMap.end(); ++itr)
+        if (itr->second.Flags & SOCIAL_FLAG_FRIEND)
+            RemoveFriendLister(itr->first, social.m_playerLowGuid);
+}
+
 void SocialMgr::GetFriendInfo(Player* player, uint32 friend_lowguid, FriendInfo& friendInfo)
 {
     if (!player)
@@ -271,22 +305,22 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket* packet)
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_IN_WHO_LIST));
     bool allowTwoSideWhoList = sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST);
 
-    for (SocialMap::const_iterator itr = m_socialMap.begin(); itr != m_socialMap.end(); ++itr)
+    FriendListersMap::const_iterator listers = m_friendListers.find(guid);
+    if (listers == m_friendListers.end())
+        return;
+
+    for (FriendListerSet::const_iterator itr = listers->second.begin(); itr != listers->second.end(); ++itr)
     {
-        PlayerSocialMap::const_iterator itr2 = itr->second.m_playerSocialMap.find(guid);
-        if (itr2 != itr->second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
+        Player* pFriend = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, *itr));
+
+        // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
+        // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
+        if (pFriend && pFriend->IsInWorld() &&
+                (pFriend->GetSession()->GetSecurity() > SEC_PLAYER ||
+                 ((pFriend->GetTeam() == team || allowTwoSideWhoList) && security <= gmLevelInWhoList)) &&
+                player->IsVisibleGloballyFor(pFriend))
         {
-            Player* pFriend = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-
-            // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
-            // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-            if (pFriend && pFriend->IsInWorld() &&
-                    (pFriend->GetSession()->GetSecurity() > SEC_PLAYER ||
-                     ((pFriend->GetTeam() == team || allowTwoSideWhoList) && security <= gmLevelInWhoList)) &&
-                    player->IsVisibleGloballyFor(pFriend))
-            {
-                pFriend->GetSession()->SendPacket(packet);
-            }
+            pFriend->GetSession()->SendPacket(packet);
         }
     }
 }
@@ -296,6 +330,10 @@ PlayerSocial* SocialMgr::LoadFromDB(QueryResult* result, ObjectGuid guid)
     PlayerSocial* social = &m_socialMap[guid.GetCounter()];
     social->SetPlayerGuid(guid);
 
+    // not removed at logout (relog case), reload from DB
+    RemoveFriendListers(*social);
+    social->m_playerSocialMap.clear();
+
     if (!result)
         return social;
 
@@ -319,6 +357,9 @@ PlayerSocial* SocialMgr::LoadFromDB(QueryResult* result, ObjectGuid guid)
 
         social->m_playerSocialMap[friend_guid] = FriendInfo(flags);
 
+        if (flags & SOCIAL_FLAG_FRIEND)
+            AddFriendLister(friend_guid, guid.GetCounter());
+
         if (flags & SOCIAL_FLAG_IGNORED)
             ++ignoreCounter;
         else
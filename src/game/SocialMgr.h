@@ -71,6 +71,8 @@ struct FriendInfo
 
 typedef std::map<uint32, FriendInfo> PlayerSocialMap;
 typedef std::map<uint32, PlayerSocial> SocialMap;
+typedef std::set<uint32> FriendListerSet;
+typedef UNORDERED_MAP<uint32, FriendListerSet> FriendListersMap;
 
 /// Results of friend related commands
 enum FriendsResult
@@ -136,7 +138,11 @@ class SocialMgr
         SocialMgr();
         ~SocialMgr();
         // Misc
-        void RemovePlayerSocial(uint32 guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(uint32 guid);
+
+        // reverse friend index: loaded players having friend_guid in friend list
+        void AddFriendLister(uint32 friend_guid, uint32 lister_guid) { m_friendListers[friend_guid].insert(lister_guid); }
+        void RemoveFriendLister(uint32 friend_guid, uint32 lister_guid);
 
         void GetFriendInfo(Player* player, uint32 friendGUID, FriendInfo& friendInfo);
         // Packet management
@@ -146,7 +152,10 @@ class SocialMgr
         // Loading
         PlayerSocial* LoadFromDB(QueryResult* result, ObjectGuid guid);
     private:
+        void RemoveFriendListers(PlayerSocial const& social);
+
         SocialMap m_socialMap;
+        FriendListersMap m_friendListers;
 };
 
 #define sSocialMgr MaNGOS::Singleton<SocialMgr>::Instance()
@@ -262,6 +262,8 @@ Spell::Spell(Unit* caster, SpellEntry const* info, bool triggered, ObjectGuid or
 	MANGOS_ASSERT(info == sSpellStore.LookupEntry(info->Id) && "`info` must be pointer to sSpellStore element");
 
 	m_spellInfo = info;
+	m_plan = sSpellMgr.GetSpellExecutionPlan(info->Id);
+	MANGOS_ASSERT(m_plan != NULL && "spell execution plans must be built before casting");
 	m_triggeredBySpellInfo = triggeredBy;
 	m_caster = caster;
 	m_selfContainer = NULL;
@@ -377,206 +379,81 @@ void Spell::FillTargetMap()
 	// TODO: ADD the correct target FILLS!!!!!!
 
 	UnitList tmpUnitLists[MAX_EFFECT_INDEX];                // Stores the temporary Target Lists for each effect
-	uint8 effToIndex[MAX_EFFECT_INDEX] = { 0, 1, 2 };         // Helper array, to link to another tmpUnitList, if the targets for both effects match
+	uint8 const* effToIndex = m_plan->effToIndex;           // Helper array, to link to another tmpUnitList, if the targets for both effects match
 	for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
 	{
-		// not call for empty effect.
+		// not call for empty effect and for script targets, those are filled in Spell::CheckCast call
 		// Also some spells use not used effect targets for store targets for dummy effect in triggered spells
-		if (m_spellInfo->Effect[i] == SPELL_EFFECT_NONE)
-			continue;
-
-		// targets for TARGET_SCRIPT_COORDINATES (A) and TARGET_SCRIPT
-		// for TARGET_FOCUS_OR_SCRIPTED_GAMEOBJECT (A) all is checked in Spell::CheckCast and in Spell::CheckItem
-		// filled in Spell::CheckCast call
-		if (m_spellInfo->EffectImplicitTargetA[i] == TARGET_SCRIPT_COORDINATES ||
-			m_spellInfo->EffectImplicitTargetA[i] == TARGET_SCRIPT ||
-			m_spellInfo->EffectImplicitTargetA[i] == TARGET_FOCUS_OR_SCRIPTED_GAMEOBJECT ||
-			(m_spellInfo->EffectImplicitTargetB[i] == TARGET_SCRIPT && m_spellInfo->EffectImplicitTargetA[i] != TARGET_SELF))
+		if (m_plan->targetFill[i] == SPELL_TARGET_FILL_NONE)
 			continue;
 
 		// TODO: find a way so this is not needed?
 		// for area auras always add caster as target (needed for totems for example)
-		if (IsAreaAuraEffect(m_spellInfo->Effect[i]))
+		if (m_plan->areaAuraMask & (1 << i))
 			AddUnitTarget(m_caster, SpellEffectIndex(i));
 
-		// no double fill for same targets
-		for (int j = 0; j < i; ++j)
-		{
-			// Check if same target, but handle i.e. AreaAuras different
-			if (m_spellInfo->EffectImplicitTargetA[i] == m_spellInfo->EffectImplicitTargetA[j] && m_spellInfo->EffectImplicitTargetB[i] == m_spellInfo->EffectImplicitTargetB[j]
-				&& m_spellInfo->Effect[j] != SPELL_EFFECT_NONE
-				&& !IsAreaAuraEffect(m_spellInfo->Effect[i]) && !IsAreaAuraEffect(m_spellInfo->Effect[j]))
-				// Add further conditions here if required
-			{
-				effToIndex[i] = j;                          // effect i has same targeting list as effect j
-				break;
-			}
-		}
-
 		if (effToIndex[i] == i)                             // New target combination
 		{
-			// TargetA/TargetB dependent from each other, we not switch to full support this dependences
-			// but need it support in some know cases
-			switch (m_spellInfo->EffectImplicitTargetA[i])
+			uint32 targetA = m_spellInfo->EffectImplicitTargetA[i];
+			uint32 targetB = m_spellInfo->EffectImplicitTargetB[i];
+			UnitList& targetUnitMap = tmpUnitLists[i /*==effToIndex[i]*/];
+
+			// selection strategy for the TargetA/TargetB pair is chosen at load, see GetSpellTargetFill
+			switch (m_plan->targetFill[i])
 			{
-			case TARGET_NONE:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_NONE:
-					if (m_caster->GetObjectGuid().IsPet())
-						SetTargetMap(SpellEffectIndex(i), TARGET_SELF, tmpUnitLists[i /*==effToIndex[i]*/]);
-					else
-						SetTargetMap(SpellEffectIndex(i), TARGET_EFFECT_SELECT, tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
+			case SPELL_TARGET_FILL_A:
+				SetTargetMap(SpellEffectIndex(i), targetA, targetUnitMap);
 				break;
-			case TARGET_SELF:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_NONE:                   // Fill Target based on A only
-					// Arcane Missiles have strange targeting for auras
-					if (m_spellInfo->SpellFamilyName == SPELLFAMILY_MAGE && m_spellInfo->SpellFamilyFlags & UI64LIT(0x00000800))
-					{
-						if (m_caster->GetTypeId() == TYPEID_PLAYER)
-							if (Unit* target = ObjectAccessor::Instance().GetUnit(*m_caster, ((Player*)m_caster)->GetSelectionGuid()))
-								if (!m_caster->IsFriendlyTo(target))
-									if (m_caster->GetDistance2d(target) <= 32.0f)
-										tmpUnitLists[i /*==effToIndex[i]*/].push_back(target);
-					}
-					else
-						SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				case TARGET_EFFECT_SELECT:
-				case TARGET_SCRIPT:                 // B-target only used with CheckCast here
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				case TARGET_AREAEFFECT_INSTANT:     // use B case that not dependent from from A in fact
-					if ((m_targets.m_targetMask & TARGET_FLAG_DEST_LOCATION) == 0)
-						m_targets.setDestination(m_caster->GetPositionX(), m_caster->GetPositionY(), m_caster->GetPositionZ());
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
+			case SPELL_TARGET_FILL_B:
+				SetTargetMap(SpellEffectIndex(i), targetB, targetUnitMap);
 				break;
-			case TARGET_EFFECT_SELECT:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_NONE:
-				case TARGET_EFFECT_SELECT:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-					// dest point setup required
-				case TARGET_AREAEFFECT_INSTANT:
-				case TARGET_AREAEFFECT_CUSTOM:
-				case TARGET_ALL_ENEMY_IN_AREA:
-				case TARGET_ALL_ENEMY_IN_AREA_INSTANT:
-				case TARGET_ALL_ENEMY_IN_AREA_CHANNELED:
-				case TARGET_ALL_FRIENDLY_UNITS_IN_AREA:
-				case TARGET_AREAEFFECT_GO_AROUND_DEST:
-					// triggered spells get dest point from default target set, ignore it
-					if (!(m_targets.m_targetMask & TARGET_FLAG_DEST_LOCATION) || m_IsTriggeredSpell)
-						if (WorldObject* castObject = GetCastingObject())
-							m_targets.setDestination(castObject->GetPositionX(), castObject->GetPositionY(), castObject->GetPositionZ());
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-					// target pre-selection required
-				case TARGET_INNKEEPER_COORDINATES:
-				case TARGET_TABLE_X_Y_Z_COORDINATES:
-				case TARGET_CASTER_COORDINATES:
-				case TARGET_SCRIPT_COORDINATES:
-				case TARGET_CURRENT_ENEMY_COORDINATES:
-				case TARGET_DUELVSPLAYER_COORDINATES:
-					// need some target for processing
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
+			case SPELL_TARGET_FILL_A_B:
+				SetTargetMap(SpellEffectIndex(i), targetA, targetUnitMap);
+				SetTargetMap(SpellEffectIndex(i), targetB, targetUnitMap);
 				break;
-			case TARGET_CASTER_COORDINATES:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_ALL_ENEMY_IN_AREA:
-					// Note: this hack with search required until GO casting not implemented
-					// environment damage spells already have around enemies targeting but this not help in case nonexistent GO casting support
-					// currently each enemy selected explicitly and self cast damage
-					if (m_spellInfo->Effect[i] == SPELL_EFFECT_ENVIRONMENTAL_DAMAGE)
-					{
-						if (m_targets.getUnitTarget())
-							tmpUnitLists[i /*==effToIndex[i]*/].push_back(m_targets.getUnitTarget());
-					}
-					else
-					{
-						SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-						SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					}
-					break;
-				case TARGET_NONE:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					tmpUnitLists[i /*==effToIndex[i]*/].push_back(m_caster);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
+			case SPELL_TARGET_FILL_DEFAULT:
+				if (m_caster->GetObjectGuid().IsPet())
+					SetTargetMap(SpellEffectIndex(i), TARGET_SELF, targetUnitMap);
+				else
+					SetTargetMap(SpellEffectIndex(i), TARGET_EFFECT_SELECT, targetUnitMap);
 				break;
-			case TARGET_TABLE_X_Y_Z_COORDINATES:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_NONE:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-
-					// need some target for processing
-					SetTargetMap(SpellEffectIndex(i), TARGET_EFFECT_SELECT, tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				case TARGET_AREAEFFECT_INSTANT:     // All 17/7 pairs used for dest teleportation, A processed in effect code
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
+			case SPELL_TARGET_FILL_ARCANE_MISSILES:
+				if (m_caster->GetTypeId() == TYPEID_PLAYER)
+					if (Unit* target = ObjectAccessor::Instance().GetUnit(*m_caster, ((Player*)m_caster)->GetSelectionGuid()))
+						if (!m_caster->IsFriendlyTo(target))
+							if (m_caster->GetDistance2d(target) <= 32.0f)
+								targetUnitMap.push_back(target);
 				break;
-			case TARGET_DUELVSPLAYER_COORDINATES:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_NONE:
-				case TARGET_EFFECT_SELECT:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					if (Unit* currentTarget = m_targets.getUnitTarget())
-						tmpUnitLists[i /*==effToIndex[i]*/].push_back(currentTarget);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
+			case SPELL_TARGET_FILL_CASTER_DEST_B:
+				if ((m_targets.m_targetMask & TARGET_FLAG_DEST_LOCATION) == 0)
+					m_targets.setDestination(m_caster->GetPositionX(), m_caster->GetPositionY(), m_caster->GetPositionZ());
+				SetTargetMap(SpellEffectIndex(i), targetB, targetUnitMap);
+				break;
+			case SPELL_TARGET_FILL_CAST_OBJECT_DEST_B:
+				// triggered spells get dest point from default target set, ignore it
+				if (!(m_targets.m_targetMask & TARGET_FLAG_DEST_LOCATION) || m_IsTriggeredSpell)
+					if (WorldObject* castObject = GetCastingObject())
+						m_targets.setDestination(castObject->GetPositionX(), castObject->GetPositionY(), castObject->GetPositionZ());
+				SetTargetMap(SpellEffectIndex(i), targetB, targetUnitMap);
+				break;
+			case SPELL_TARGET_FILL_A_CASTER:
+				SetTargetMap(SpellEffectIndex(i), targetA, targetUnitMap);
+				targetUnitMap.push_back(m_caster);
+				break;
+			case SPELL_TARGET_FILL_A_EFFECT_SELECT:
+				SetTargetMap(SpellEffectIndex(i), targetA, targetUnitMap);
+				SetTargetMap(SpellEffectIndex(i), TARGET_EFFECT_SELECT, targetUnitMap);
+				break;
+			case SPELL_TARGET_FILL_A_UNIT_TARGET:
+				SetTargetMap(SpellEffectIndex(i), targetA, targetUnitMap);
+				if (Unit* currentTarget = m_targets.getUnitTarget())
+					targetUnitMap.push_back(currentTarget);
+				break;
+			case SPELL_TARGET_FILL_UNIT_TARGET:
+				if (Unit* currentTarget = m_targets.getUnitTarget())
+					targetUnitMap.push_back(currentTarget);
 				break;
 			default:
-				switch (m_spellInfo->EffectImplicitTargetB[i])
-				{
-				case TARGET_NONE:
-				case TARGET_EFFECT_SELECT:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				case TARGET_SCRIPT_COORDINATES:     // B case filled in CheckCast but we need fill unit list base at A case
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				default:
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetA[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					SetTargetMap(SpellEffectIndex(i), m_spellInfo->EffectImplicitTargetB[i], tmpUnitLists[i /*==effToIndex[i]*/]);
-					break;
-				}
 				break;
 			}
 		}
@@ -716,7 +593,7 @@ void Spell::prepareDataForTriggerSystem()
 		}
 		break;
 	default:
-		if (IsPositiveSpell(m_spellInfo->Id))           // Check for positive spell
+		if (m_plan->positive)                       // Check for positive spell
 		{
 			m_procAttacker = PROC_FLAG_SUCCESSFUL_POSITIVE_SPELL;
 			m_procVictim = PROC_FLAG_TAKEN_POSITIVE_SPELL;
@@ -1010,7 +887,7 @@ void Spell::DoAllEffectOnTarget(TargetInfo* target)
 			if (real_caster && real_caster != unit)
 			{
 				// can cause back attack (if detected)
-				if (!m_spellInfo->HasAttribute(SPELL_ATTR_EX3_NO_INITIAL_AGGRO) && !IsPositiveSpell(m_spellInfo->Id) &&
+				if (!m_spellInfo->HasAttribute(SPELL_ATTR_EX3_NO_INITIAL_AGGRO) && !m_plan->positive &&
 					m_caster->isVisibleForOrDetect(unit, unit, false))
 				{
 					if (!unit->isInCombat() && unit->GetTypeId() != TYPEID_PLAYER && ((Creature*)unit)->AI())
@@ -1203,7 +1080,7 @@ void Spell::DoSpellHitOnUnit(Unit* unit, uint32 effectMask, bool isReflected)
 				unit->RemoveSpellsCausingAura(SPELL_AURA_MOD_STEALTH);
 
 			// can cause back attack (if detected), stealth removed at Spell::cast if spell break it
-			if (!m_spellInfo->HasAttribute(SPELL_ATTR_EX3_NO_INITIAL_AGGRO) && !IsPositiveSpell(m_spellInfo->Id) &&
+			if (!m_spellInfo->HasAttribute(SPELL_ATTR_EX3_NO_INITIAL_AGGRO) && !m_plan->positive &&
 				m_caster->isVisibleForOrDetect(unit, unit, false))
 			{
 				// use speedup check to avoid re-remove after above lines
@@ -1230,7 +1107,7 @@ void Spell::DoSpellHitOnUnit(Unit* unit, uint32 effectMask, bool isReflected)
 		else
 		{
 			// for delayed spells ignore negative spells (after duel end) for friendly targets
-			if (speed > 0.0f && !IsPositiveSpell(m_spellInfo->Id))
+			if (speed > 0.0f && !m_plan->positive)
 			{
 				realCaster->SendSpellMiss(unit, m_spellInfo->Id, SPELL_MISS_EVADE);
 				ResetEffectDamageAndHeal();
@@ -2809,7 +2686,7 @@ void Spell::cast(bool skipCheck)
 			{
 				if (Spell* spell = m_caster->GetCurrentSpell(CurrentSpellTypes(i)))
 				{
-					if (spell->m_spellInfo->Id == 75 && m_caster->IsHostileTo(m_targets.getUnitTarget()) && !IsPositiveSpell(m_spellInfo->Id) && m_targets.getUnitTarget()->isTargetableForAttack())
+					if (spell->m_spellInfo->Id == 75 && m_caster->IsHostileTo(m_targets.getUnitTarget()) && !m_plan->positive && m_targets.getUnitTarget()->isTargetableForAttack())
 					{
 						if (spell->m_targets.getUnitTarget() != m_targets.getUnitTarget())
 							spell->m_targets.setUnitTarget(m_targets.getUnitTarget());
@@ -3277,7 +3154,7 @@ void Spell::finish(bool ok)
 	{
 		// Not drop combopoints if negative spell and if any miss on enemy exist
 		bool needDrop = true;
-		if (!IsPositiveSpell(m_spellInfo->Id))
+		if (!m_plan->positive)
 		{
 			for (TargetList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
 			{
@@ -3889,7 +3766,7 @@ void Spell::TakeAmmo()
 
 void Spell::TakeReagents()
 {
-	if (m_caster->GetTypeId() != TYPEID_PLAYER)
+	if (m_caster->GetTypeId() != TYPEID_PLAYER || !(m_plan->castChecks & SPELL_CAST_CHECK_REAGENTS))
 		return;
 
 	if (IgnoreItemRequirements())                           // reagents used in triggered spell removed by original spell or don't must be removed.
@@ -4120,9 +3997,12 @@ SpellCastResult Spell::CheckCast(bool strict)
 	if (strict && !m_IsTriggeredSpell)
 	{
 		// Cannot be used in this stance/form
-		SpellCastResult shapeError = GetErrorAtShapeshiftedCast(m_spellInfo, m_caster->GetShapeshiftForm());
-		if (shapeError != SPELL_CAST_OK)
-			return shapeError;
+		if (m_plan->castChecks & SPELL_CAST_CHECK_SHAPESHIFT)
+		{
+			SpellCastResult shapeError = GetErrorAtShapeshiftedCast(m_spellInfo, m_caster->GetShapeshiftForm());
+			if (shapeError != SPELL_CAST_OK)
+				return shapeError;
+		}
 
 		if (m_spellInfo->HasAttribute(SPELL_ATTR_ONLY_STEALTHED) && !(m_caster->HasStealthAura()))
 			return SPELL_FAILED_ONLY_STEALTHED;
@@ -4320,7 +4200,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 			if (!explicit_target_mode && m_caster->GetTypeId() == TYPEID_UNIT && m_caster->GetCharmerOrOwnerGuid() && !IsDispelSpell(m_spellInfo))
 			{
 				// check correctness positive/negative cast target (pet cast real check and cheating check)
-				if (IsPositiveSpell(m_spellInfo->Id))
+				if (m_plan->positive)
 				{
 					if (!target_hostile_checked)
 					{
@@ -4345,7 +4225,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 			}
 		}
 
-		if (IsPositiveSpell(m_spellInfo->Id))
+		if (m_plan->positive)
 			if (target->IsImmuneToSpell(m_spellInfo, target == m_caster))
 				return SPELL_FAILED_TARGET_AURASTATE;
 
@@ -5619,7 +5499,7 @@ SpellCastResult Spell::CheckPetCast(Unit* target)
 			if (!_target->isTargetableForAttack())
 				return SPELL_FAILED_BAD_TARGETS;            // guessed error
 
-			if (IsPositiveSpell(m_spellInfo->Id) && !IsDispelSpell(m_spellInfo))
+			if (m_plan->positive && !IsDispelSpell(m_spellInfo))
 			{
 				if (m_caster->IsHostileTo(_target))
 					return SPELL_FAILED_BAD_TARGETS;
@@ -5867,7 +5747,7 @@ SpellCastResult Spell::CheckRange(bool strict)
 		if (min_range && (dist + 1.5f) < min_range)
 			return SPELL_FAILED_TOO_CLOSE;
 		if (m_caster->GetTypeId() == TYPEID_PLAYER &&
-			(sSpellMgr.GetSpellFacingFlag(m_spellInfo->Id) & SPELL_FACING_FLAG_INFRONT) && !m_caster->HasInArc(M_PI_F, target))
+			(m_plan->facingFlags & SPELL_FACING_FLAG_INFRONT) && !m_caster->HasInArc(M_PI_F, target))
 			return SPELL_FAILED_UNIT_NOT_INFRONT;
 	}
 
@@ -5881,7 +5761,7 @@ SpellCastResult Spell::CheckRange(bool strict)
 		if (min_range && dist < min_range)
 			return SPELL_FAILED_TOO_CLOSE;
 		if (m_caster->GetTypeId() == TYPEID_PLAYER &&
-			(sSpellMgr.GetSpellFacingFlag(m_spellInfo->Id) & SPELL_FACING_FLAG_INFRONT) && !m_caster->HasInArc(M_PI_F, pGoTarget))
+			(m_plan->facingFlags & SPELL_FACING_FLAG_INFRONT) && !m_caster->HasInArc(M_PI_F, pGoTarget))
 			return SPELL_FAILED_NOT_INFRONT;
 	}
 
@@ -6112,7 +5992,7 @@ SpellCastResult Spell::CheckItems()
 	}
 
 	// check spell focus object
-	if (m_spellInfo->RequiresSpellFocus)
+	if (m_plan->castChecks & SPELL_CAST_CHECK_SPELL_FOCUS)
 	{
 		GameObject* ok = NULL;
 		MaNGOS::GameObjectFocusCheck go_check(m_caster, m_spellInfo->RequiresSpellFocus);
@@ -6128,7 +6008,7 @@ SpellCastResult Spell::CheckItems()
 	// check reagents (ignore triggered spells with reagents processed by original spell) and special reagent ignore case.
 	if (!IgnoreItemRequirements())
 	{
-		if (!p_caster->CanNoReagentCast(m_spellInfo))
+		if ((m_plan->castChecks & SPELL_CAST_CHECK_REAGENTS) && !p_caster->CanNoReagentCast(m_spellInfo))
 		{
 			for (uint32 i = 0; i < MAX_SPELL_REAGENTS; ++i)
 			{
@@ -6162,23 +6042,26 @@ SpellCastResult Spell::CheckItems()
 		}
 
 		// check totem-item requirements (items presence in inventory)
-		uint32 totems = MAX_SPELL_TOTEMS;
-		for (int i = 0; i < MAX_SPELL_TOTEMS; ++i)
+		if (m_plan->castChecks & SPELL_CAST_CHECK_TOTEMS)
 		{
-			if (m_spellInfo->Totem[i] != 0)
+			uint32 totems = MAX_SPELL_TOTEMS;
+			for (int i = 0; i < MAX_SPELL_TOTEMS; ++i)
 			{
-				if (p_caster->HasItemCount(m_spellInfo->Totem[i], 1))
+				if (m_spellInfo->Totem[i] != 0)
 				{
-					totems -= 1;
-					continue;
+					if (p_caster->HasItemCount(m_spellInfo->Totem[i], 1))
+					{
+						totems -= 1;
+						continue;
+					}
 				}
+				else
+					totems -= 1;
 			}
-			else
-				totems -= 1;
-		}
 
-		if (totems != 0)
-			return SPELL_FAILED_ITEM_GONE;                  //[-ZERO] not sure of it
+			if (totems != 0)
+				return SPELL_FAILED_ITEM_GONE;              //[-ZERO] not sure of it
+		}
 
 		/*[-ZERO] to rewrite?
 		// Check items for TotemCategory  (items presence in inventory)
@@ -6565,7 +6448,7 @@ bool Spell::CheckTarget(Unit* target, SpellEffectIndex eff)
 		if (((Player*)target)->GetVisibility() == VISIBILITY_OFF)
 			return false;
 
-		if (((Player*)target)->isGameMaster() && !IsPositiveSpell(m_spellInfo->Id))
+		if (((Player*)target)->isGameMaster() && !m_plan->positive)
 			return false;
 	}
 
@@ -35,6 +35,7 @@ class Item;
 class GameObject;
 class Group;
 class Aura;
+struct SpellExecutionPlan;
 
 enum SpellCastFlags
 {
@@ -391,6 +392,7 @@ class Spell
         // void HandleAddAura(Unit* Target);
 
         SpellEntry const* m_spellInfo;
+        SpellExecutionPlan const* m_plan;                   // precomputed by SpellMgr for m_spellInfo
         SpellEntry const* m_triggeredBySpellInfo;
         int32 m_currentBasePoints[MAX_EFFECT_INDEX];        // cache SpellEntry::CalculateSimpleValue and use for set custom base points
 
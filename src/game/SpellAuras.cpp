@@ -6043,9 +6043,15 @@ void SpellAuraHolder::RemoveAura(SpellEffectIndex index)
 
 void SpellAuraHolder::ApplyAuraModifiers(bool apply, bool real)
 {
+    // holder can be deleted while applying, the target outlives it
+    Unit* target = m_target;
+    target->BeginStatUpdateBatch();
+
     for (int32 i = 0; i < MAX_EFFECT_INDEX && !IsDeleted(); ++i)
         if (Aura* aur = GetAuraByEffectIndex(SpellEffectIndex(i)))
             aur->ApplyModifier(apply, real);
+
+    target->EndStatUpdateBatch();
 }
 
 void SpellAuraHolder::_AddSpellAuraHolder()
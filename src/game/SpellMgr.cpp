@@ -4053,3 +4053,196 @@ void SpellMgr::LoadFacingCasterFlags()
     sLog.outString();
     sLog.outString(">> Loaded %u facing caster flags", count);
 }
+
+// TargetA/TargetB dependent from each other, we not switch to full support this dependences
+// but need it support in some know cases
+static SpellTargetFill GetSpellTargetFill(SpellEntry const* spellInfo, SpellEffectIndex i)
+{
+    uint32 targetB = spellInfo->EffectImplicitTargetB[i];
+
+    switch (spellInfo->EffectImplicitTargetA[i])
+    {
+        case TARGET_NONE:
+            return targetB == TARGET_NONE ? SPELL_TARGET_FILL_DEFAULT : SPELL_TARGET_FILL_B;
+        case TARGET_SELF:
+            switch (targetB)
+            {
+                case TARGET_NONE:                           // Fill Target based on A only
+                    // Arcane Missiles have strange targeting for auras
+                    if (spellInfo->SpellFamilyName == SPELLFAMILY_MAGE && spellInfo->SpellFamilyFlags & UI64LIT(0x00000800))
+                        return SPELL_TARGET_FILL_ARCANE_MISSILES;
+                    return SPELL_TARGET_FILL_A;
+                case TARGET_EFFECT_SELECT:
+                case TARGET_SCRIPT:                         // B-target only used with CheckCast here
+                    return SPELL_TARGET_FILL_A;
+                case TARGET_AREAEFFECT_INSTANT:             // use B case that not dependent from from A in fact
+                    return SPELL_TARGET_FILL_CASTER_DEST_B;
+                default:
+                    return SPELL_TARGET_FILL_A_B;
+            }
+        case TARGET_EFFECT_SELECT:
+            switch (targetB)
+            {
+                case TARGET_NONE:
+                case TARGET_EFFECT_SELECT:
+                    return SPELL_TARGET_FILL_A;
+                // dest point setup required
+                case TARGET_AREAEFFECT_INSTANT:
+                case TARGET_AREAEFFECT_CUSTOM:
+                case TARGET_ALL_ENEMY_IN_AREA:
+                case TARGET_ALL_ENEMY_IN_AREA_INSTANT:
+                case TARGET_ALL_ENEMY_IN_AREA_CHANNELED:
+                case TARGET_ALL_FRIENDLY_UNITS_IN_AREA:
+                case TARGET_AREAEFFECT_GO_AROUND_DEST:
+                    return SPELL_TARGET_FILL_CAST_OBJECT_DEST_B;
+                // target pre-selection required
+                case TARGET_INNKEEPER_COORDINATES:
+                case TARGET_TABLE_X_Y_Z_COORDINATES:
+                case TARGET_CASTER_COORDINATES:
+                case TARGET_SCRIPT_COORDINATES:
+                case TARGET_CURRENT_ENEMY_COORDINATES:
+                case TARGET_DUELVSPLAYER_COORDINATES:
+                    // need some target for processing
+                    return SPELL_TARGET_FILL_A_B;
+                default:
+                    return SPELL_TARGET_FILL_B;
+            }
+        case TARGET_CASTER_COORDINATES:
+            switch (targetB)
+            {
+                case TARGET_ALL_ENEMY_IN_AREA:
+                    // Note: this hack with search required until GO casting not implemented
+                    // environment damage spells already have around enemies targeting but this not help in case nonexistent GO casting support
+                    // currently each enemy selected explicitly and self cast damage
+                    if (spellInfo->Effect[i] == SPELL_EFFECT_ENVIRONMENTAL_DAMAGE)
+                        return SPELL_TARGET_FILL_UNIT_TARGET;
+                    return SPELL_TARGET_FILL_A_B;
+                case TARGET_NONE:
+                    return SPELL_TARGET_FILL_A_CASTER;
+                default:
+                    return SPELL_TARGET_FILL_A_B;
+            }
+        case TARGET_TABLE_X_Y_Z_COORDINATES:
+            switch (targetB)
+            {
+                case TARGET_NONE:
+                    // need some target for processing
+                    return SPELL_TARGET_FILL_A_EFFECT_SELECT;
+                case TARGET_AREAEFFECT_INSTANT:             // All 17/7 pairs used for dest teleportation, A processed in effect code
+                    return SPELL_TARGET_FILL_B;
+                default:
+                    return SPELL_TARGET_FILL_A_B;
+            }
+        case TARGET_DUELVSPLAYER_COORDINATES:
+            switch (targetB)
+            {
+                case TARGET_NONE:
+                case TARGET_EFFECT_SELECT:
+                    return SPELL_TARGET_FILL_A_UNIT_TARGET;
+                default:
+                    return SPELL_TARGET_FILL_A_B;
+            }
+        default:
+            switch (targetB)
+            {
+                case TARGET_NONE:
+                case TARGET_EFFECT_SELECT:
+                case TARGET_SCRIPT_COORDINATES:             // B case filled in CheckCast but we need fill unit list base at A case
+                    return SPELL_TARGET_FILL_A;
+                default:
+                    return SPELL_TARGET_FILL_A_B;
+            }
+    }
+}
+
+void SpellMgr::FillSpellExecutionPlan(SpellEntry const* spellInfo, SpellExecutionPlan& plan) const
+{
+    plan.effectMask = 0;
+    plan.areaAuraMask = 0;
+    plan.castChecks = 0;
+
+    for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
+    {
+        plan.effToIndex[i] = i;
+        plan.targetFill[i] = SPELL_TARGET_FILL_NONE;
+
+        if (spellInfo->Effect[i] == SPELL_EFFECT_NONE)
+            continue;
+
+        plan.effectMask |= (1 << i);
+
+        if (IsAreaAuraEffect(spellInfo->Effect[i]))
+            plan.areaAuraMask |= (1 << i);
+
+        // targets for TARGET_SCRIPT_COORDINATES (A) and TARGET_SCRIPT
+        // for TARGET_FOCUS_OR_SCRIPTED_GAMEOBJECT (A) all is checked in Spell::CheckCast and in Spell::CheckItem
+        if (spellInfo->EffectImplicitTargetA[i] == TARGET_SCRIPT_COORDINATES ||
+                spellInfo->EffectImplicitTargetA[i] == TARGET_SCRIPT ||
+                spellInfo->EffectImplicitTargetA[i] == TARGET_FOCUS_OR_SCRIPTED_GAMEOBJECT ||
+                (spellInfo->EffectImplicitTargetB[i] == TARGET_SCRIPT && spellInfo->EffectImplicitTargetA[i] != TARGET_SELF))
+            continue;
+
+        plan.targetFill[i] = GetSpellTargetFill(spellInfo, SpellEffectIndex(i));
+
+        // no double fill for same targets, area auras always get own list
+        for (int j = 0; j < i; ++j)
+        {
+            if (spellInfo->EffectImplicitTargetA[i] == spellInfo->EffectImplicitTargetA[j] && spellInfo->EffectImplicitTargetB[i] == spellInfo->EffectImplicitTargetB[j]
+                    && spellInfo->Effect[j] != SPELL_EFFECT_NONE
+                    && !IsAreaAuraEffect(spellInfo->Effect[i]) && !IsAreaAuraEffect(spellInfo->Effect[j]))
+            {
+                plan.effToIndex[i] = j;
+                break;
+            }
+        }
+    }
+
+    // talents that learn spells pass any stance, see GetErrorAtShapeshiftedCast
+    bool learnsTalent = GetTalentSpellCost(spellInfo->Id) > 0 && IsSpellHaveEffect(spellInfo, SPELL_EFFECT_LEARN_SPELL);
+    if (!learnsTalent && (spellInfo->Stances || spellInfo->StancesNot || spellInfo->HasAttribute(SPELL_ATTR_NOT_SHAPESHIFT)))
+        plan.castChecks |= SPELL_CAST_CHECK_SHAPESHIFT;
+
+    if (spellInfo->RequiresSpellFocus)
+        plan.castChecks |= SPELL_CAST_CHECK_SPELL_FOCUS;
+
+    for (int i = 0; i < MAX_SPELL_REAGENTS; ++i)
+        if (spellInfo->Reagent[i] > 0)
+            plan.castChecks |= SPELL_CAST_CHECK_REAGENTS;
+
+    for (int i = 0; i < MAX_SPELL_TOTEMS; ++i)
+        if (spellInfo->Totem[i])
+            plan.castChecks |= SPELL_CAST_CHECK_TOTEMS;
+
+    plan.facingFlags = GetSpellFacingFlag(spellInfo->Id);
+    plan.positive = IsPositiveSpell(spellInfo);
+}
+
+void SpellMgr::LoadSpellExecutionPlans()
+{
+    mSpellExecutionPlans.clear();
+    mSpellExecutionPlans.resize(sSpellStore.GetNumRows());
+
+    uint32 count = 0;
+
+    BarGoLink bar(sSpellStore.GetNumRows());
+
+    for (uint32 i = 0; i < sSpellStore.GetNumRows(); ++i)
+    {
+        bar.step();
+
+        SpellExecutionPlan& plan = mSpellExecutionPlans[i];
+
+        SpellEntry const* spellInfo = sSpellStore.LookupEntry(i);
+        if (!spellInfo)
+        {
+            memset(&plan, 0, sizeof(plan));
+            continue;
+        }
+
+        FillSpellExecutionPlan(spellInfo, plan);
+        ++count;
+    }
+
+    sLog.outString();
+    sLog.outString(">> Built %u spell execution plans", count);
+}
@@ -804,6 +804,46 @@ inline bool IsProfessionOrRidingSkill(uint32 skill)
 
 typedef std::map<uint32, uint32> SpellFacingFlagMap;
 
+// How Spell::FillTargetMap selects targets of an effect from its EffectImplicitTargetA/B pair
+enum SpellTargetFill
+{
+    SPELL_TARGET_FILL_NONE              = 0,                // not filled, empty effect or script targets filled in CheckCast
+    SPELL_TARGET_FILL_A                 = 1,                // target A only
+    SPELL_TARGET_FILL_B                 = 2,                // target B only
+    SPELL_TARGET_FILL_A_B               = 3,                // target A, then target B
+    SPELL_TARGET_FILL_DEFAULT           = 4,                // no implicit targets, self for pets else TARGET_EFFECT_SELECT
+    SPELL_TARGET_FILL_ARCANE_MISSILES   = 5,                // hostile selection of the player caster in 32 yards
+    SPELL_TARGET_FILL_CASTER_DEST_B     = 6,                // caster position as destination if none is set, then target B
+    SPELL_TARGET_FILL_CAST_OBJECT_DEST_B = 7,               // casting object position as destination, then target B
+    SPELL_TARGET_FILL_A_CASTER          = 8,                // target A, then the caster
+    SPELL_TARGET_FILL_A_EFFECT_SELECT   = 9,                // target A, then TARGET_EFFECT_SELECT
+    SPELL_TARGET_FILL_A_UNIT_TARGET     = 10,               // target A, then the current unit target
+    SPELL_TARGET_FILL_UNIT_TARGET       = 11,               // the current unit target only
+};
+
+// CheckCast and CheckItems checks that depend on the spell only, cleared checks always pass
+enum SpellCastCheckFlags
+{
+    SPELL_CAST_CHECK_SHAPESHIFT         = 0x01,             // Stances, StancesNot or SPELL_ATTR_NOT_SHAPESHIFT
+    SPELL_CAST_CHECK_SPELL_FOCUS        = 0x02,             // RequiresSpellFocus
+    SPELL_CAST_CHECK_REAGENTS           = 0x04,             // Reagent
+    SPELL_CAST_CHECK_TOTEMS             = 0x08,             // Totem
+};
+
+// Cast time facts derived once per spell from SpellEntry and spell_facing, see Spell::FillTargetMap and Spell::CheckCast
+struct SpellExecutionPlan
+{
+    uint8 effectMask;                                       // effects that are not SPELL_EFFECT_NONE
+    uint8 areaAuraMask;                                     // area aura effects, caster is always added as target
+    uint8 effToIndex[MAX_EFFECT_INDEX];                     // effect whose target list is shared, same implicit targets and no area auras
+    uint8 targetFill[MAX_EFFECT_INDEX];                     // SpellTargetFill of each effect
+    uint8 castChecks;                                       // SpellCastCheckFlags
+    uint32 facingFlags;                                     // spell_facing flags
+    bool positive;                                          // IsPositiveSpell result
+};
+
+typedef std::vector<SpellExecutionPlan> SpellExecutionPlanList;
+
 class SpellMgr
 {
         friend struct DoSpellBonuses;
@@ -912,6 +952,14 @@ class SpellMgr
             return 0x0;
         }
 
+        // Spell execution plans, NULL before LoadSpellExecutionPlans
+        SpellExecutionPlan const* GetSpellExecutionPlan(uint32 spellId) const
+        {
+            return spellId < mSpellExecutionPlans.size() ? &mSpellExecutionPlans[spellId] : NULL;
+        }
+
+        void FillSpellExecutionPlan(SpellEntry const* spellInfo, SpellExecutionPlan& plan) const;
+
         // Spell target coordinates
         SpellTargetPosition const* GetSpellTargetPosition(uint32 spell_id) const
         {
@@ -1096,6 +1144,7 @@ class SpellMgr
         void LoadSpellPetAuras();
         void LoadSpellAreas();
         void LoadFacingCasterFlags();
+        void LoadSpellExecutionPlans();
 
     private:
         SpellChainMap      mSpellChains;
@@ -1116,6 +1165,7 @@ class SpellMgr
         SpellAreaForAuraMap  mSpellAreaForAuraMap;
         SpellAreaForAreaMap  mSpellAreaForAreaMap;
         SpellFacingFlagMap  mSpellFacingFlagMap;
+        SpellExecutionPlanList mSpellExecutionPlans;
 };
 
 #define sSpellMgr SpellMgr::Instance()
@@ -46,20 +46,21 @@ bool Player::UpdateStats(Stats stat)
             pet->UpdateStats(stat);
     }
 
+    // dependent values are only marked, several stats changed together recompute them once
     switch (stat)
     {
         case STAT_STRENGTH:
             break;
         case STAT_AGILITY:
-            UpdateArmor();
-            UpdateAllCritPercentages();
-            UpdateDodgePercentage();
+            MarkStatDirty(UNIT_MOD_ARMOR);
+            MarkStatDirty(STAT_UPDATE_CRIT);
+            MarkStatDirty(STAT_UPDATE_DODGE);
             break;
-        case STAT_STAMINA:   UpdateMaxHealth(); break;
+        case STAT_STAMINA:   MarkStatDirty(UNIT_MOD_HEALTH); break;
         case STAT_INTELLECT:
-            UpdateMaxPower(POWER_MANA);
-            UpdateAllSpellCritChances();
-            UpdateArmor();                                  // SPELL_AURA_MOD_RESISTANCE_OF_INTELLECT_PERCENT, only armor currently
+            MarkStatDirty(UNIT_MOD_MANA);
+            MarkStatDirty(STAT_UPDATE_SPELL_CRIT);
+            MarkStatDirty(UNIT_MOD_ARMOR);                  // SPELL_AURA_MOD_RESISTANCE_OF_INTELLECT_PERCENT, only armor currently
             break;
 
         case STAT_SPIRIT:
@@ -69,15 +70,31 @@ bool Player::UpdateStats(Stats stat)
             break;
     }
     // Need update (exist AP from stat auras)
-    UpdateAttackPowerAndDamage();
-    UpdateAttackPowerAndDamage(true);
+    MarkStatDirty(UNIT_MOD_ATTACK_POWER);
+    MarkStatDirty(UNIT_MOD_ATTACK_POWER_RANGED);
 
-    UpdateSpellDamageAndHealingBonus();
-    UpdateManaRegen();
+    MarkStatDirty(STAT_UPDATE_SPELL_DAMAGE);
+    MarkStatDirty(STAT_UPDATE_MANA_REGEN);
+
+    if (!m_statUpdateBatchDepth)
+        UpdateDirtyStats();
 
     return true;
 }
 
+void Player::UpdateStatGroup(uint32 group)
+{
+    switch (group)
+    {
+        case STAT_UPDATE_CRIT:          UpdateAllCritPercentages();         break;
+        case STAT_UPDATE_DODGE:         UpdateDodgePercentage();            break;
+        case STAT_UPDATE_SPELL_CRIT:    UpdateAllSpellCritChances();        break;
+        case STAT_UPDATE_SPELL_DAMAGE:  UpdateSpellDamageAndHealingBonus(); break;
+        case STAT_UPDATE_MANA_REGEN:    UpdateManaRegen();                  break;
+        default:                        Unit::UpdateStatGroup(group);       break;
+    }
+}
+
 void Player::UpdateSpellDamageAndHealingBonus()
 {
     // Magic damage modifiers implemented in Unit::SpellDamageBonusDone
@@ -313,7 +330,7 @@ void Player::UpdateAttackPowerAndDamage(bool ranged)
     // automatically update weapon damage after attack power modification
     if (ranged)
     {
-        UpdateDamagePhysical(RANGED_ATTACK);
+        RequestStatUpdate(UNIT_MOD_DAMAGE_RANGED);
 
         Pet* pet = GetPet();                                // update pet's AP
         if (pet)
@@ -321,9 +338,9 @@ void Player::UpdateAttackPowerAndDamage(bool ranged)
     }
     else
     {
-        UpdateDamagePhysical(BASE_ATTACK);
+        RequestStatUpdate(UNIT_MOD_DAMAGE_MAINHAND);
         if (CanDualWield() && haveOffhandWeapon())          // allow update offhand damage only if player knows DualWield Spec and has equipped offhand weapon
-            UpdateDamagePhysical(OFF_ATTACK);
+            RequestStatUpdate(UNIT_MOD_DAMAGE_OFFHAND);
     }
 }
 
@@ -111,6 +111,7 @@ void MapManager::LoadTransports()
 
         // If we someday decide to use the grid to track transports, here:
         t->SetMap(sMapMgr.CreateMap(mapid, t));
+        t->GetMap()->AddTransport(t);
 
         // t->GetMap()->Add<GameObject>((GameObject *)t);
         ++count;
@@ -140,7 +141,7 @@ void MapManager::LoadTransports()
     sLog.outString();
 }
 
-Transport::Transport() : GameObject()
+Transport::Transport() : GameObject(), m_transferPending(false)
 {
     m_updateFlag = (UPDATEFLAG_TRANSPORT | UPDATEFLAG_ALL | UPDATEFLAG_HAS_POSITION);
 }
@@ -459,17 +460,28 @@ void Transport::TeleportTransport(uint32 newMapid, float x, float y, float z)
         // plr->GetSession()->SendPacket(&data);
     }
 
+    if (newMapid == GetMapId())
+        return;
+
     // we need to create and save new Map object with 'newMapid' because if not done -> lead to invalid Map object reference...
     // player far teleport would try to create same instance, but we need it NOW for transport...
     // correct me if I'm wrong O.o
     Map* newMap = sMapMgr.CreateMap(newMapid, this);
+    GetMap()->RemoveTransport(this);
     SetMap(newMap);
+    newMap->AddTransport(this);
 
-    if (oldMap != newMap)
-    {
-        UpdateForMap(oldMap);
-        UpdateForMap(newMap);
-    }
+    UpdateForMap(oldMap);
+    UpdateForMap(newMap);
+}
+
+void Transport::FinishMapTransfer()
+{
+    if (!m_transferPending)
+        return;
+
+    m_transferPending = false;
+    TeleportTransport(m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
 }
 
 bool Transport::AddPassenger(Player* passenger)
@@ -494,13 +506,23 @@ void Transport::Update(uint32 /*update_diff*/, uint32 /*p_time*/)
     if (m_WayPoints.size() <= 1)
         return;
 
+    // other map must take it first
+    if (m_transferPending)
+        return;
+
     m_timer = WorldTimer::getMSTime() % m_period;
     while (((m_timer - m_curr->first) % m_pathTime) > ((m_next->first - m_curr->first) % m_pathTime))
     {
         MoveToNextWayPoint();
 
         // first check help in case client-server transport coordinates de-synchronization
-        if (m_curr->second.mapid != GetMapId() || m_curr->second.teleport)
+        if (m_curr->second.mapid != GetMapId())
+        {
+            // passengers and other map can't be touched from this map update, MapManager finishes the move
+            m_transferPending = true;
+            sMapMgr.ScheduleTransportTransfer(this);
+        }
+        else if (m_curr->second.teleport)
         {
             TeleportTransport(m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
         }
@@ -524,6 +546,10 @@ void Transport::Update(uint32 /*update_diff*/, uint32 /*p_time*/)
             DETAIL_FILTER_LOG(LOG_FILTER_TRANSPORT_MOVES, " ************ BEGIN ************** %s", GetName());
 
         DETAIL_FILTER_LOG(LOG_FILTER_TRANSPORT_MOVES, "%s moved to %f %f %f %d", GetName(), m_curr->second.x, m_curr->second.y, m_curr->second.z, m_curr->second.mapid);
+
+        // next waypoints are processed at new map
+        if (m_transferPending)
+            break;
     }
 }
 
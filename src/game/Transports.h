@@ -39,6 +39,9 @@ class Transport : public GameObject
         typedef std::set<Player*> PlayerSet;
         PlayerSet const& GetPassengers() const { return m_passengers; }
 
+        // moves transport and passengers to the map of current waypoint, must be called while maps are not updated
+        void FinishMapTransfer();
+
     private:
         struct WayPoint
         {
@@ -58,6 +61,7 @@ class Transport : public GameObject
         WayPointMap::const_iterator m_next;
         uint32 m_pathTime;
         uint32 m_timer;
+        bool m_transferPending;                             // waits for MapManager to move it to other map
 
         PlayerSet m_passengers;
 
@@ -212,6 +212,11 @@ Unit::Unit() :
     m_invisibilityMask = 0;
     m_transform = 0;
     m_canModifyStats = false;
+    m_dirtyStats = 0;
+    m_statUpdateBatchDepth = 0;
+    m_statUpdateResolving = false;
+    m_statUpdatesRequested = 0;
+    m_statUpdatesDone = 0;
 
     for (int i = 0; i < MAX_SPELL_IMMUNITY; ++i)
         m_spellImmune[i].clear();
@@ -7926,6 +7931,56 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
     if (!CanModifyStats())
         return false;
 
+    RequestStatUpdate(unitMod);
+    return true;
+}
+
+void Unit::RequestStatUpdate(uint32 group)
+{
+    MarkStatDirty(group);
+
+    if (!m_statUpdateBatchDepth)
+        UpdateDirtyStats();
+}
+
+void Unit::EndStatUpdateBatch()
+{
+    MANGOS_ASSERT(m_statUpdateBatchDepth);
+
+    if (--m_statUpdateBatchDepth == 0 && m_dirtyStats)
+        UpdateDirtyStats();
+}
+
+void Unit::UpdateDirtyStats()
+{
+    // groups marked while resolving are picked up by the running loop
+    if (m_statUpdateResolving)
+        return;
+
+    m_statUpdateResolving = true;
+
+    // always take the lowest group, recomputing it can mark higher groups depending on it
+    while (m_dirtyStats)
+    {
+        uint32 group = 0;
+        while (!(m_dirtyStats & (1 << group)))
+            ++group;
+
+        m_dirtyStats &= ~(1 << group);
+        ++m_statUpdatesDone;
+        UpdateStatGroup(group);
+    }
+
+    m_statUpdateResolving = false;
+}
+
+void Unit::UpdateStatGroup(uint32 group)
+{
+    if (group >= UNIT_MOD_END)
+        return;
+
+    UnitMods unitMod = UnitMods(group);
+
     switch (unitMod)
     {
         case UNIT_MOD_STAT_STRENGTH:
@@ -7960,8 +8015,6 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
         default:
             break;
     }
-
-    return true;
 }
 
 float Unit::GetModifierValue(UnitMods unitMod, UnitModifierType modifierType) const
@@ -8067,6 +8120,8 @@ Powers Unit::GetPowerTypeByAuraGroup(UnitMods unitMod) const
 
 float Unit::GetTotalAttackPowerValue(WeaponAttackType attType) const
 {
+    ResolveDirtyStats();
+
     if (attType == RANGED_ATTACK)
     {
         int32 ap = GetInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER) + GetInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER_MODS);
@@ -9878,6 +9933,14 @@ void Unit::UpdateSplineMovement(uint32 t_diff)
     if (m_movesplineTimer.Passed() || arrived)
     {
         m_movesplineTimer.Reset(POSITION_UPDATE_DELAY);
+
+        // moving creatures are relocated together at the end of the map update, the final position is needed at once
+        if (GetTypeId() != TYPEID_PLAYER && !arrived)
+        {
+            GetMap()->QueueSplinePosition((Creature*)this);
+            return;
+        }
+
         Movement::Location loc = movespline->ComputePosition();
 
         if (GetTypeId() == TYPEID_PLAYER)
@@ -331,6 +331,18 @@ enum UnitMods
     UNIT_MOD_POWER_END = UNIT_MOD_HAPPINESS + 1
 };
 
+// stat groups recomputed by Unit::UpdateDirtyStats, groups below UNIT_MOD_END are the UnitMods values
+// the order is the recomputation order, so groups only depend on lower groups
+enum StatUpdateGroup
+{
+    STAT_UPDATE_CRIT = UNIT_MOD_END,
+    STAT_UPDATE_DODGE,
+    STAT_UPDATE_SPELL_CRIT,
+    STAT_UPDATE_SPELL_DAMAGE,
+    STAT_UPDATE_MANA_REGEN,
+    STAT_UPDATE_END
+};
+
 enum BaseModGroup
 {
     CRIT_PERCENTAGE,
@@ -1232,7 +1244,7 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         uint32 getClassMask() const { return 1 << (getClass() - 1); }
         uint8 getGender() const { return GetByteValue(UNIT_FIELD_BYTES_0, 2); }
 
-        float GetStat(Stats stat) const { return float(GetUInt32Value(UNIT_FIELD_STAT0 + stat)); }
+        float GetStat(Stats stat) const { ResolveDirtyStats(); return float(GetUInt32Value(UNIT_FIELD_STAT0 + stat)); }
         void SetStat(Stats stat, int32 val) { SetStatInt32Value(UNIT_FIELD_STAT0 + stat, val); }
         uint32 GetArmor() const { return GetResistance(SPELL_SCHOOL_NORMAL) ; }
         void SetArmor(int32 val) { SetResistance(SPELL_SCHOOL_NORMAL, val); }
@@ -1240,11 +1252,11 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
 		void SetRace(int32 val) { SetByteValue(UNIT_FIELD_BYTES_0, 0, val); }
 		void SetClass(int32 val) { SetByteValue(UNIT_FIELD_BYTES_0, 1, val); }
 
-        uint32 GetResistance(SpellSchools school) const { return GetUInt32Value(UNIT_FIELD_RESISTANCES + school); }
+        uint32 GetResistance(SpellSchools school) const { ResolveDirtyStats(); return GetUInt32Value(UNIT_FIELD_RESISTANCES + school); }
         void SetResistance(SpellSchools school, int32 val) { SetStatInt32Value(UNIT_FIELD_RESISTANCES + school, val); }
 
         uint32 GetHealth()    const { return GetUInt32Value(UNIT_FIELD_HEALTH); }
-        uint32 GetMaxHealth() const { return GetUInt32Value(UNIT_FIELD_MAXHEALTH); }
+        uint32 GetMaxHealth() const { ResolveDirtyStats(); return GetUInt32Value(UNIT_FIELD_MAXHEALTH); }
         float GetHealthPercent() const { return (GetHealth() * 100.0f) / GetMaxHealth(); }
         void SetHealth(uint32 val);
         void SetMaxHealth(uint32 val);
@@ -1254,7 +1266,7 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         Powers GetPowerType() const { return Powers(GetByteValue(UNIT_FIELD_BYTES_0, 3)); }
         void SetPowerType(Powers power);
         uint32 GetPower(Powers power) const { return GetUInt32Value(UNIT_FIELD_POWER1 + power); }
-        uint32 GetMaxPower(Powers power) const { return GetUInt32Value(UNIT_FIELD_MAXPOWER1 + power); }
+        uint32 GetMaxPower(Powers power) const { ResolveDirtyStats(); return GetUInt32Value(UNIT_FIELD_MAXPOWER1 + power); }
         void SetPower(Powers power, uint32 val);
         void SetMaxPower(Powers power, uint32 val);
         int32 ModifyPower(Powers power, int32 val);
@@ -1642,6 +1654,17 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         Powers GetPowerTypeByAuraGroup(UnitMods unitMod) const;
         bool CanModifyStats() const { return m_canModifyStats; }
         void SetCanModifyStats(bool modifyStats) { m_canModifyStats = modifyStats; }
+
+        // Stat groups changed inside a batch are recomputed once when the batch ends or a stat getter is used
+        void BeginStatUpdateBatch() { ++m_statUpdateBatchDepth; }
+        void EndStatUpdateBatch();
+        void MarkStatDirty(uint32 group) { m_dirtyStats |= (1 << group); ++m_statUpdatesRequested; }
+        void RequestStatUpdate(uint32 group);
+        void UpdateDirtyStats();
+        void ResolveDirtyStats() const { if (m_dirtyStats) const_cast<Unit*>(this)->UpdateDirtyStats(); }
+        uint32 GetStatUpdatesRequested() const { return m_statUpdatesRequested; }
+        uint32 GetStatUpdatesDone() const { return m_statUpdatesDone; }
+
         virtual bool UpdateStats(Stats stat) = 0;
         virtual bool UpdateAllStats() = 0;
         virtual void UpdateResistances(uint32 school) = 0;
@@ -1882,6 +1905,8 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
     protected:
         explicit Unit();
 
+        virtual void UpdateStatGroup(uint32 group);
+
         void _UpdateSpells(uint32 time);
         void _UpdateAutoRepeatSpell();
         bool m_AutoRepeatFirstCast;
@@ -1916,6 +1941,11 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
         float m_weaponDamage[MAX_ATTACK][2];
         bool m_canModifyStats;
+        uint32 m_dirtyStats;                                // StatUpdateGroup bits waiting for recomputation
+        uint32 m_statUpdateBatchDepth;
+        bool m_statUpdateResolving;
+        uint32 m_statUpdatesRequested;
+        uint32 m_statUpdatesDone;
         // std::list< spellEffectPair > AuraSpells[TOTAL_AURAS];  // TODO: use this if ok for mem
 
         float m_speed_rate[MAX_MOVE_TYPE];
@@ -61,11 +61,12 @@ class UpdateData
 
         GuidSet const& GetOutOfRangeGUIDs() const { return m_outOfRangeGUIDs; }
 
+        // zlib compression with the configured level, dst_size is 0 at failure
+        static void Compress(void* dst, uint32* dst_size, void* src, int src_size);
+
     protected:
         uint32 m_blockCount;
         GuidSet m_outOfRangeGUIDs;
         ByteBuffer m_data;
-
-        void Compress(void* dst, uint32* dst_size, void* src, int src_size);
 };
 #endif
@@ -0,0 +1,247 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "WhoListCache.h"
+#include "Policies/Singleton.h"
+#include "WorldPacket.h"
+#include "WorldSession.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "GuildMgr.h"
+#include "DBCStores.h"
+#include "Util.h"
+
+INSTANTIATE_SINGLETON_1(WhoListCache);
+
+// 49 is maximum player count sent to client
+#define WHO_LIST_MAX_DISPLAYED 49
+
+static bool WhoListEntryLevelLess(WhoListEntry const& left, WhoListEntry const& right)
+{
+    return left.level < right.level;
+}
+
+static bool WhoListEntryLevelBelow(WhoListEntry const& entry, uint32 level)
+{
+    return entry.level < level;
+}
+
+WhoListCache::WhoListCache()
+{
+}
+
+void WhoListCache::Update()
+{
+    TeamBucket buckets[PVP_TEAM_COUNT];
+
+    // guild names are resolved once per guild and refresh
+    typedef UNORDERED_MAP<uint32, std::string> GuildNameMap;
+    GuildNameMap guildNames;
+
+    {
+        HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
+        HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
+        for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+        {
+            Player* pl = itr->second;
+            if (!pl->IsInWorld())
+                continue;
+
+            WhoListEntry entry;
+            entry.guid = pl->GetObjectGuid();
+            entry.name = pl->GetName();
+            if (!Utf8toWStr(entry.name, entry.wname))
+                continue;
+            wstrToLower(entry.wname);
+
+            if (uint32 guildId = pl->GetGuildId())
+            {
+                GuildNameMap::const_iterator gItr = guildNames.find(guildId);
+                if (gItr == guildNames.end())
+                    gItr = guildNames.insert(GuildNameMap::value_type(guildId, sGuildMgr.GetGuildNameById(guildId))).first;
+                entry.guildName = gItr->second;
+            }
+            if (!Utf8toWStr(entry.guildName, entry.wguildName))
+                continue;
+            wstrToLower(entry.wguildName);
+
+            entry.zoneId = pl->GetZoneId();
+            entry.security = pl->GetSession()->GetSecurity();
+            entry.level = pl->getLevel();
+            entry.class_ = pl->getClass();
+            entry.race = pl->getRace();
+            entry.hidden = pl->GetVisibility() == VISIBILITY_OFF;
+            entry.alwaysVisible = pl->GetVisibility() == VISIBILITY_ON;
+
+            PvpTeamIndex teamIdx = pl->GetTeam() == ALLIANCE ? TEAM_INDEX_ALLIANCE : TEAM_INDEX_HORDE;
+            buckets[teamIdx].entries.push_back(entry);
+        }
+    }
+
+    for (uint8 i = 0; i < PVP_TEAM_COUNT; ++i)
+    {
+        EntryList& entries = buckets[i].entries;
+        std::stable_sort(entries.begin(), entries.end(), WhoListEntryLevelLess);
+
+        for (uint32 j = 0; j < entries.size(); ++j)
+            buckets[i].zones[entries[j].zoneId].push_back(j);
+    }
+
+    ACE_Write_Guard<LockType> guard(m_lock);
+    for (uint8 i = 0; i < PVP_TEAM_COUNT; ++i)
+    {
+        m_buckets[i].entries.swap(buckets[i].entries);
+        m_buckets[i].zones.swap(buckets[i].zones);
+    }
+}
+
+uint32 WhoListCache::BuildWhoList(WhoListQuery const& query, WorldPacket& data, uint32& displayCount) const
+{
+    uint32 matchCount = 0;
+    displayCount = 0;
+
+    ACE_Read_Guard<LockType> guard(m_lock);
+
+    for (uint8 i = 0; i < PVP_TEAM_COUNT; ++i)
+    {
+        Team bucketTeam = i == TEAM_INDEX_ALLIANCE ? ALLIANCE : HORDE;
+        if (query.team != TEAM_NONE && query.team != bucketTeam)
+            continue;
+
+        ScanBucket(m_buckets[i], query, data, matchCount, displayCount);
+    }
+
+    return matchCount;
+}
+
+void WhoListCache::ScanBucket(TeamBucket const& bucket, WhoListQuery const& query, WorldPacket& data, uint32& matchCount, uint32& displayCount) const
+{
+    if (query.zonesCount)
+    {
+        for (uint32 i = 0; i < query.zonesCount; ++i)
+        {
+            // client may send the same zone more than once
+            bool duplicate = false;
+            for (uint32 j = 0; j < i; ++j)
+            {
+                if (query.zoneIds[j] == query.zoneIds[i])
+                {
+                    duplicate = true;
+                    break;
+                }
+            }
+            if (duplicate)
+                continue;
+
+            ZoneIndexMap::const_iterator zItr = bucket.zones.find(query.zoneIds[i]);
+            if (zItr == bucket.zones.end())
+                continue;
+
+            for (IndexList::const_iterator itr = zItr->second.begin(); itr != zItr->second.end(); ++itr)
+            {
+                WhoListEntry const& entry = bucket.entries[*itr];
+                if (entry.level < query.levelMin || entry.level > query.levelMax)
+                    continue;
+
+                AddEntry(entry, query, data, matchCount, displayCount);
+            }
+        }
+        return;
+    }
+
+    EntryList::const_iterator itr = std::lower_bound(bucket.entries.begin(), bucket.entries.end(), query.levelMin, WhoListEntryLevelBelow);
+    for (; itr != bucket.entries.end() && itr->level <= query.levelMax; ++itr)
+        AddEntry(*itr, query, data, matchCount, displayCount);
+}
+
+void WhoListCache::AddEntry(WhoListEntry const& entry, WhoListQuery const& query, WorldPacket& data, uint32& matchCount, uint32& displayCount) const
+{
+    if (!Matches(entry, query))
+        return;
+
+    ++matchCount;
+    if (matchCount > WHO_LIST_MAX_DISPLAYED)
+        return;
+
+    ++displayCount;
+
+    data << entry.name;                                     // player name
+    data << entry.guildName;                                // guild name
+    data << uint32(entry.level);                            // player level
+    data << uint32(entry.class_);                           // player class
+    data << uint32(entry.race);                             // player race
+    data << uint32(entry.zoneId);                           // player zone id
+}
+
+bool WhoListCache::Matches(WhoListEntry const& entry, WhoListQuery const& query) const
+{
+    // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
+    if (query.security == SEC_PLAYER && entry.security > query.gmLevelInWhoList)
+        return false;
+
+    // same rules as Player::IsVisibleGloballyFor
+    if (entry.guid != query.viewerGuid && !entry.alwaysVisible)
+    {
+        if (query.security > SEC_PLAYER)
+        {
+            if (entry.security > query.security)
+                return false;
+        }
+        else if (entry.hidden)
+            return false;
+    }
+
+    if (!(query.classMask & (1 << entry.class_)))
+        return false;
+
+    if (!(query.raceMask & (1 << entry.race)))
+        return false;
+
+    if (!query.playerName.empty() && entry.wname.find(query.playerName) == std::wstring::npos)
+        return false;
+
+    if (!query.guildName.empty() && entry.wguildName.find(query.guildName) == std::wstring::npos)
+        return false;
+
+    bool s_show = true;
+    std::string aname;
+    bool anameLoaded = false;
+    for (uint32 i = 0; i < query.strCount; ++i)
+    {
+        if (query.strings[i].empty())
+            continue;
+
+        if (entry.wguildName.find(query.strings[i]) != std::wstring::npos ||
+                entry.wname.find(query.strings[i]) != std::wstring::npos)
+            return true;
+
+        if (!anameLoaded)
+        {
+            if (AreaTableEntry const* areaEntry = GetAreaEntryByAreaID(entry.zoneId))
+                aname = areaEntry->area_name[query.locale];
+            anameLoaded = true;
+        }
+
+        if (Utf8FitTo(aname, query.strings[i]))
+            return true;
+
+        s_show = false;
+    }
+
+    return s_show;
+}
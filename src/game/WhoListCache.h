@@ -0,0 +1,113 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __MANGOS_WHOLISTCACHE_H
+#define __MANGOS_WHOLISTCACHE_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+#include "SharedDefines.h"
+#include "ObjectGuid.h"
+
+#include <ace/RW_Thread_Mutex.h>
+
+class WorldPacket;
+
+// Copy of the /who relevant state of one in-world player, names are kept pre-lowercased for matching
+struct WhoListEntry
+{
+    ObjectGuid guid;
+    std::string name;
+    std::string guildName;
+    std::wstring wname;
+    std::wstring wguildName;
+    uint32 zoneId;
+    AccountTypes security;
+    uint8 level;
+    uint8 class_;
+    uint8 race;
+    bool hidden;                                            // VISIBILITY_OFF at snapshot time
+    bool alwaysVisible;                                     // VISIBILITY_ON at snapshot time
+};
+
+// Already parsed and normalized CMSG_WHO request
+struct WhoListQuery
+{
+    WhoListQuery() : levelMin(0), levelMax(0), raceMask(0), classMask(0), zonesCount(0), strCount(0),
+        team(TEAM_NONE), security(SEC_PLAYER), gmLevelInWhoList(SEC_PLAYER), locale(LOCALE_enUS) {}
+
+    uint32 levelMin;
+    uint32 levelMax;
+    uint32 raceMask;
+    uint32 classMask;
+    uint32 zonesCount;
+    uint32 zoneIds[10];                                     // 10 is client limit
+    uint32 strCount;
+    std::wstring strings[4];                                // 4 is client limit, lowercased
+    std::wstring playerName;                                // lowercased
+    std::wstring guildName;                                 // lowercased
+
+    ObjectGuid viewerGuid;
+    Team team;                                              // TEAM_NONE if both sides are listed
+    AccountTypes security;
+    AccountTypes gmLevelInWhoList;                          // highest security listed for SEC_PLAYER viewers
+    LocaleConstant locale;                                  // dbc locale of the requesting session
+};
+
+/**
+ * Periodically refreshed snapshot of the online players used to answer /who.
+ *
+ * The snapshot is rebuilt in the world thread and queries only scan it, so
+ * CMSG_WHO handling never touches live Player objects. Entries are bucketed
+ * by team, sorted by level and indexed by zone.
+ */
+class WhoListCache
+{
+    public:
+        WhoListCache();
+
+        // Rebuild the snapshot from the players currently in world
+        void Update();
+
+        // Appends the matching entries to an SMSG_WHO packet, returns the count of all matches
+        uint32 BuildWhoList(WhoListQuery const& query, WorldPacket& data, uint32& displayCount) const;
+
+    private:
+        typedef std::vector<WhoListEntry> EntryList;
+        typedef std::vector<uint32> IndexList;
+        typedef UNORDERED_MAP<uint32, IndexList> ZoneIndexMap;
+
+        struct TeamBucket
+        {
+            EntryList entries;                              // sorted by level
+            ZoneIndexMap zones;                             // zone id -> indexes into entries
+        };
+
+        bool Matches(WhoListEntry const& entry, WhoListQuery const& query) const;
+        void AddEntry(WhoListEntry const& entry, WhoListQuery const& query, WorldPacket& data, uint32& matchCount, uint32& displayCount) const;
+        void ScanBucket(TeamBucket const& bucket, WhoListQuery const& query, WorldPacket& data, uint32& matchCount, uint32& displayCount) const;
+
+        TeamBucket m_buckets[PVP_TEAM_COUNT];
+
+        typedef ACE_RW_Thread_Mutex LockType;
+        mutable LockType m_lock;
+};
+
+#define sWhoListCache MaNGOS::Singleton<WhoListCache>::Instance()
+
+#endif
@@ -63,6 +63,7 @@
 #include "CharacterDatabaseCleaner.h"
 #include "CreatureLinkingMgr.h"
 #include "Weather.h"
+#include "WhoListCache.h"
 #include "Language.h"
 #include "extras/Mod.h"
 
@@ -113,11 +114,31 @@ World::World()
         m_configBoolValues[i] = false;
 
     m_configForceLoadMapIds = NULL;
+    m_honorMaintenanceThread = NULL;
 }
 
+/// Weekly honor flush, only works on the character DB so it does not need the world thread
+class HonorMaintenanceRunnable : public ACE_Based::Runnable
+{
+    public:
+        explicit HonorMaintenanceRunnable(uint32 dateTop) : m_dateTop(dateTop) {}
+
+        void run() override
+        {
+            CharacterDatabase.ThreadStart();
+            ObjectMgr::FlushRankPoints(m_dateTop);
+            CharacterDatabase.ThreadEnd();
+        }
+
+    private:
+        uint32 m_dateTop;
+};
+
 /// World destructor
 World::~World()
 {
+    WaitServerMaintenance();
+
     ///- Empty the kicked session set
     while (!m_sessions.empty())
     {
@@ -682,8 +703,10 @@ void World::LoadConfigSettings(bool reload)
 	m_MvAnticheatMaxXDBX                      = sConfig.GetFloatDefault("Anticheat.Movement.MaxXDBX", 0.012f);
     m_MvAnticheatIgnoreAfterTeleport        = (uint16)sConfig.GetIntDefault("Anticheat.Movement.IgnoreSecAfterTeleport",10);
     setConfigMinMax(CONFIG_UINT32_COMPRESSION, "Compression", 1, 1, 9);
+    setConfig(CONFIG_BOOL_BATCH_MONSTER_MOVES, "BatchMonsterMoves", true);
     setConfig(CONFIG_BOOL_ADDON_CHANNEL, "AddonChannel", true);
     setConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB, "CleanCharacterDB", true);
+    setConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB_DRY_RUN, "CleanCharacterDB.DryRun", false);
     setConfig(CONFIG_BOOL_GRID_UNLOAD, "GridUnload", true);
 
     std::string forceLoadGridOnMaps = sConfig.GetStringDefault("LoadAllGridsOnMaps", "");
@@ -704,6 +727,7 @@ void World::LoadConfigSettings(bool reload)
     setConfigMin(CONFIG_UINT32_INTERVAL_GRIDCLEAN, "GridCleanUpDelay", 5 * MINUTE * IN_MILLISECONDS, MIN_GRID_DELAY);
     if (reload)
         sMapMgr.SetGridCleanUpDelay(getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN));
+    setConfig(CONFIG_UINT32_GRID_MEMORY_BUDGET, "GridUnload.MemoryBudget", 0);
 
 	setConfig(CONFIG_UINT32_NUMTHREADS, "MapUpdate.Threads", 3);
     setConfig(CONFIG_BOOL_THREADS_DYNAMIC,"MapUpdate.DynamicThreadsCount", false); 
@@ -811,6 +835,8 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
     setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 10, 1);
+    // ids of a batch are listed in one query, keep it below MAX_QUERY_LEN (up to 11 chars per id)
+    setConfigMinMax(CONFIG_UINT32_MAIL_RETURN_PER_TICK, "MailReturnPerTick", 100, 1, 2500);
 
     setConfig(CONFIG_UINT32_UPTIME_UPDATE, "UpdateUptimeInterval", 10);
     if (reload)
@@ -819,6 +845,15 @@ void World::LoadConfigSettings(bool reload)
         m_timers[WUPDATE_UPTIME].Reset();
     }
 
+    setConfigMin(CONFIG_UINT32_WHO_LIST_UPDATE_INTERVAL, "WhoList.UpdateInterval", 5 * IN_MILLISECONDS, 100);
+    if (reload)
+    {
+        m_timers[WUPDATE_WHO_LIST].SetInterval(getConfig(CONFIG_UINT32_WHO_LIST_UPDATE_INTERVAL));
+        m_timers[WUPDATE_WHO_LIST].Reset();
+    }
+
+    setConfig(CONFIG_UINT32_CHAR_ENUM_CACHE_LIFETIME, "CharEnumCache.Lifetime", 5 * MINUTE);
+
     setConfig(CONFIG_UINT32_SKILL_CHANCE_ORANGE, "SkillChance.Orange", 100);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_YELLOW, "SkillChance.Yellow", 75);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_GREEN,  "SkillChance.Green",  25);
@@ -904,6 +939,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_BATTLEGROUND_INVITATION_TYPE,              "Battleground.InvitationType", 0);
     setConfig(CONFIG_UINT32_BATTLEGROUND_PREMATURE_FINISH_TIMER,       "BattleGround.PrematureFinishTimer", 5 * MINUTE * IN_MILLISECONDS);
     setConfig(CONFIG_UINT32_BATTLEGROUND_PREMADE_GROUP_WAIT_FOR_MATCH, "BattleGround.PremadeGroupWaitForMatch", 0);
+    setConfig(CONFIG_UINT32_BATTLEGROUND_SCOREBOARD_UPDATE_INTERVAL,  "BattleGround.ScoreboardUpdateInterval", 1 * IN_MILLISECONDS);
     setConfig(CONFIG_BOOL_OUTDOORPVP_SI_ENABLED,                       "OutdoorPvp.SIEnabled", true);
     setConfig(CONFIG_BOOL_OUTDOORPVP_EP_ENABLED,                       "OutdoorPvp.EPEnabled", true);
 
@@ -1123,6 +1159,21 @@ void World::SetInitialWorldSettings()
         exit(1);
     }
 
+    ///- Preload vmap models of the configured maps so their tile loads don't read model files
+    std::string preloadVMapIds = sConfig.GetStringDefault("vmap.preloadMapIds", "");
+    VMAP::IVMapManager* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+    if (!preloadVMapIds.empty() && vmgr->isMapLoadingEnabled())
+    {
+        unsigned int pos = 0;
+        unsigned int id;
+        VMAP::VMapFactory::chompAndTrim(preloadVMapIds);
+        while (VMAP::VMapFactory::getNextId(preloadVMapIds, pos, id))
+        {
+            uint32 count = vmgr->preloadMapModels((m_dataPath + "vmaps").c_str(), id);
+            sLog.outString("Preloaded %u vmap models for map %u", count, id);
+        }
+    }
+
     ///- Loading strings. Getting no records means core load has to be canceled because no error message can be output.
     sLog.outString("Loading MaNGOS strings...");
     if (!sObjectMgr.LoadMangosStrings())
@@ -1170,6 +1221,9 @@ void World::SetInitialWorldSettings()
     sLog.outString("Packing instances...");
     sMapPersistentStateMgr.PackInstances();
 
+    sLog.outString("Loading instance data...");
+    sMapPersistentStateMgr.LoadSavedInstanceData();         // must be after packing instances
+
     sLog.outString("Packing groups...");
     sObjectMgr.PackGroupIds();                              // must be after CleanupInstances
 
@@ -1196,6 +1250,9 @@ void World::SetInitialWorldSettings()
     sLog.outString("Loading Spell Facing Flags...");
     sSpellMgr.LoadFacingCasterFlags();
 
+    sLog.outString("Building Spell Execution Plans...");
+    sSpellMgr.LoadSpellExecutionPlans();                    // must be after LoadFacingCasterFlags
+
     sLog.outString("Loading Spell Learn Skills...");
     sSpellMgr.LoadSpellLearnSkills();                       // must be after LoadSpellChains
 
@@ -1508,6 +1565,7 @@ void World::SetInitialWorldSettings()
     m_timers[WUPDATE_CORPSES].SetInterval(20 * MINUTE * IN_MILLISECONDS);
     m_timers[WUPDATE_DELETECHARS].SetInterval(DAY * IN_MILLISECONDS); // check for chars to delete every day
 	m_timers[WUPDATE_AUTOBROADCAST].SetInterval(abtimer);
+    m_timers[WUPDATE_WHO_LIST].SetInterval(getConfig(CONFIG_UINT32_WHO_LIST_UPDATE_INTERVAL));
 
     // for AhBot
     m_timers[WUPDATE_AHBOT].SetInterval(20*IN_MILLISECONDS);// every 20 sec
@@ -1521,18 +1579,15 @@ void World::SetInitialWorldSettings()
 
 	Worldsdebug = false;
 
-    // to set mailtimer to return mails every day between 4 and 5 am
-    // mailtimer is increased when updating auctions
-    // one second is 1000 -(tested on win system)
-    mail_timer = uint32((((localtime(&m_gameTime)->tm_hour + 20) % 24) * HOUR * IN_MILLISECONDS) / m_timers[WUPDATE_AUCTIONS].GetInterval());
-    // 1440
-    mail_timer_expires = uint32((DAY * IN_MILLISECONDS) / (m_timers[WUPDATE_AUCTIONS].GetInterval()));
-    DEBUG_LOG("Mail timer set to: %u, mail return is called every %u minutes", mail_timer, mail_timer_expires);
-
     ///- Initialize static helper structures
     AIRegistry::Initialize();
     Player::InitVisibleBits();
 
+    ///- Honor flush reads DBC stores (race teams), start it only after all static data is loaded
+    ///- it runs while maps, battlegrounds and transports are initialized
+    sLog.outString("Starting server Maintenance system...");
+    InitServerMaintenanceCheck();
+
     ///- Initialize MapManager
     sLog.outString("Starting Map System");
     sMapMgr.Initialize();
@@ -1554,8 +1609,8 @@ void World::SetInitialWorldSettings()
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE unbandate<=UNIX_TIMESTAMP() AND unbandate<>bandate");
     sLog.outString();
 
-    sLog.outString("Starting server Maintenance system...");
-    InitServerMaintenanceCheck();
+    sLog.outString("Waiting for server Maintenance...");
+    WaitServerMaintenance();
 
     sLog.outString("Loading Honor Standing list...");
     sObjectMgr.LoadStandingList();
@@ -1655,19 +1710,14 @@ void World::Update(uint32 diff)
     ///-Update mass mailer tasks if any
     sMassMailMgr.Update();
 
+    ///- Return or delete the next batch of expired mails, if any
+    sObjectMgr.ReturnOrDeleteOldMails(true);
+
     /// <ul><li> Handle auctions when the timer has passed
     if (m_timers[WUPDATE_AUCTIONS].Passed())
     {
         m_timers[WUPDATE_AUCTIONS].Reset();
 
-        ///- Update mails (return old mails with item, or delete them)
-        //(tested... works on win)
-        if (++mail_timer > mail_timer_expires)
-        {
-            mail_timer = 0;
-            sObjectMgr.ReturnOrDeleteOldMails(true);
-        }
-
         ///- Handle expired auctions
         sAuctionMgr.Update();
     }
@@ -1679,6 +1729,13 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_AHBOT].Reset();
     }
 
+    /// <li> Refresh the players snapshot used by /who
+    if (m_timers[WUPDATE_WHO_LIST].Passed())
+    {
+        m_timers[WUPDATE_WHO_LIST].Reset();
+        sWhoListCache.Update();
+    }
+
     /// <li> Handle session updates
     UpdateSessions(diff);
 
@@ -2236,15 +2293,26 @@ void World::ServerMaintenanceStart()
     if (m_NextMaintenanceDate <= GetDateToday())            // avoid loop in manually case, maybe useless
         m_NextMaintenanceDate += 7;
 
-    // flushing rank points list ( standing must be reloaded after server maintenance )
-    sObjectMgr.FlushRankPoints(LastWeekEnd);
-
-    // save and update all online players
+    // save and update all online players, before the flush so their old rating can't overwrite it
     for (SessionMap::iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
         if (itr->second->GetPlayer() && itr->second->GetPlayer()->IsInWorld())
             itr->second->GetPlayer()->SaveToDB();
 
     CharacterDatabase.PExecute("UPDATE saved_variables SET NextMaintenanceDate = '"UI64FMTD"'", uint64(m_NextMaintenanceDate));
+
+    // flushing rank points list ( standing must be reloaded after server maintenance )
+    WaitServerMaintenance();
+    m_honorMaintenanceThread = new ACE_Based::Thread(new HonorMaintenanceRunnable(LastWeekEnd));
+}
+
+void World::WaitServerMaintenance()
+{
+    if (!m_honorMaintenanceThread)
+        return;
+
+    m_honorMaintenanceThread->wait();
+    delete m_honorMaintenanceThread;
+    m_honorMaintenanceThread = NULL;
 }
 
 void World::InitServerMaintenanceCheck()
@@ -74,7 +74,8 @@ enum WorldTimers
     WUPDATE_DELETECHARS = 4,
     WUPDATE_AHBOT       = 5,
 	WUPDATE_AUTOBROADCAST = 6,
-    WUPDATE_COUNT       = 7
+    WUPDATE_WHO_LIST    = 7,
+    WUPDATE_COUNT       = 8
 };
 
 /// Configuration elements
@@ -83,6 +84,7 @@ enum eConfigUInt32Values
     CONFIG_UINT32_COMPRESSION = 0,
     CONFIG_UINT32_INTERVAL_SAVE,
     CONFIG_UINT32_INTERVAL_GRIDCLEAN,
+    CONFIG_UINT32_GRID_MEMORY_BUDGET,
     CONFIG_UINT32_INTERVAL_MAPUPDATE,
     CONFIG_UINT32_INTERVAL_CHANGEWEATHER,
     CONFIG_UINT32_PORT_WORLD,
@@ -125,7 +127,10 @@ enum eConfigUInt32Values
     CONFIG_UINT32_GROUP_VISIBILITY,
     CONFIG_UINT32_MAIL_DELIVERY_DELAY,
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
+    CONFIG_UINT32_MAIL_RETURN_PER_TICK,
     CONFIG_UINT32_UPTIME_UPDATE,
+    CONFIG_UINT32_WHO_LIST_UPDATE_INTERVAL,
+    CONFIG_UINT32_CHAR_ENUM_CACHE_LIFETIME,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_SKILL_CHANCE_ORANGE,
     CONFIG_UINT32_SKILL_CHANCE_YELLOW,
@@ -159,6 +164,7 @@ enum eConfigUInt32Values
     CONFIG_UINT32_BATTLEGROUND_INVITATION_TYPE,
     CONFIG_UINT32_BATTLEGROUND_PREMATURE_FINISH_TIMER,
     CONFIG_UINT32_BATTLEGROUND_PREMADE_GROUP_WAIT_FOR_MATCH,
+    CONFIG_UINT32_BATTLEGROUND_SCOREBOARD_UPDATE_INTERVAL,
     CONFIG_UINT32_BATTLEGROUND_QUEUE_ANNOUNCER_JOIN,
     CONFIG_UINT32_GUILD_EVENT_LOG_COUNT,
     CONFIG_UINT32_TIMERBAR_FATIGUE_GMLEVEL,
@@ -550,6 +556,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET,
     CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_BOOL_CLEAN_CHARACTER_DB,
+    CONFIG_BOOL_CLEAN_CHARACTER_DB_DRY_RUN,
     CONFIG_BOOL_VMAP_INDOOR_CHECK,
     CONFIG_BOOL_PET_UNSUMMON_AT_MOUNT,
     CONFIG_BOOL_MMAP_ENABLED,
@@ -574,6 +581,7 @@ enum eConfigBoolValues
 	CONFIG_BOOL_THREADS_DYNAMIC,
 	CONFIG_BOOL_VMSS_ENABLE,
 	CONFIG_BOOL_VMSS_TRYSKIPFIRST,
+    CONFIG_BOOL_BATCH_MONSTER_MOVES,
     CONFIG_BOOL_VALUE_COUNT
 };
 
@@ -836,6 +844,8 @@ class World
 
         void InitServerMaintenanceCheck();
         void ServerMaintenanceStart();
+        // wait for the honor flush started by ServerMaintenanceStart
+        void WaitServerMaintenance();
 
 		void PlayerWorldMailGuid(ItemPairs items, Player* pPlayer, std::string msgSubject, std::string msgText);
 
@@ -914,12 +924,11 @@ class World
 
         uint32 m_NextMaintenanceDate;
         uint32 m_MaintenanceTimeChecker;
+        ACE_Based::Thread* m_honorMaintenanceThread;
 
         time_t m_startTime;
         time_t m_gameTime;
         IntervalTimer m_timers[WUPDATE_COUNT];
-        uint32 mail_timer;
-        uint32 mail_timer_expires;
 
         typedef UNORDERED_MAP<uint32, WorldSession*> SessionMap;
         SessionMap m_sessions;
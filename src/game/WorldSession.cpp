@@ -39,6 +39,8 @@
 #include "SocialMgr.h"
 #include "AccountMgr.h"
 
+#include <zlib/zlib.h>
+
 // select opcodes appropriate for processing in Map::Update context for current session state
 static bool MapSessionFilterHelper(WorldSession* session, OpcodeHandler const& opHandle)
 {
@@ -85,7 +87,7 @@ WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, time_
 	_player(NULL), m_Socket(sock), _security(sec), _accountId(id), _logoutTime(0),
     m_inQueue(false), m_playerLoading(false), m_playerLogout(false), m_playerRecentlyLogout(false), m_playerSave(false),
     m_sessionDbcLocale(sWorld.GetAvailableDbcLocale(locale)), m_sessionDbLocaleIndex(sObjectMgr.GetIndexForLocale(locale)),
-	m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED), expireTime(30000), forceExit(false)
+	m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED), m_monsterMoveCount(0), expireTime(30000), forceExit(false)
 {
     if (sock)
     {
@@ -172,6 +174,76 @@ void WorldSession::SendPacket(WorldPacket const* packet)
         m_Socket->CloseSocket();
 }
 
+void WorldSession::QueueMonsterMove(WorldPacket const* packet)
+{
+    if (!m_Socket)
+        return;
+
+    // batched packets store opcode and payload size in one byte
+    if (packet->size() + sizeof(uint16) > 0xFF)
+    {
+        SendQueuedMonsterMoves();                           // keep moves of the same unit in order
+        SendPacket(packet);
+        return;
+    }
+
+    m_monsterMoves << uint8(packet->size() + sizeof(uint16));
+    m_monsterMoves << uint16(packet->GetOpcode());
+    if (!packet->empty())
+        m_monsterMoves.append(packet->contents(), packet->size());
+    ++m_monsterMoveCount;
+}
+
+void WorldSession::SendQueuedMonsterMoves()
+{
+    if (!m_monsterMoveCount)
+        return;
+
+    if (m_monsterMoveCount == 1 || !m_Socket)
+    {
+        SendQueuedMonsterMovesUncompressed();
+        return;
+    }
+
+    uint32 size = m_monsterMoves.wpos();
+    uint32 destsize = compressBound(size);
+
+    WorldPacket data(SMSG_COMPRESSED_MOVES, destsize + sizeof(uint32));
+    data.resize(destsize + sizeof(uint32));
+    data.put<uint32>(0, size);
+    UpdateData::Compress(const_cast<uint8*>(data.contents()) + sizeof(uint32), &destsize, (void*)m_monsterMoves.contents(), size);
+    if (destsize == 0)
+    {
+        SendQueuedMonsterMovesUncompressed();
+        return;
+    }
+
+    data.resize(destsize + sizeof(uint32));
+    SendPacket(&data);
+
+    m_monsterMoves.clear();
+    m_monsterMoveCount = 0;
+}
+
+void WorldSession::SendQueuedMonsterMovesUncompressed()
+{
+    for (size_t pos = 0; pos < m_monsterMoves.wpos();)
+    {
+        uint8 size = m_monsterMoves.read<uint8>(pos);
+        uint16 opcode = m_monsterMoves.read<uint16>(pos + 1);
+
+        WorldPacket data(opcode, size - sizeof(uint16));
+        if (size > sizeof(uint16))
+            data.append(m_monsterMoves.contents() + pos + 3, size - sizeof(uint16));
+        SendPacket(&data);
+
+        pos += 1 + size;
+    }
+
+    m_monsterMoves.clear();
+    m_monsterMoveCount = 0;
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -440,6 +512,7 @@ void WorldSession::LogoutPlayer(bool Save)
             }
 
             guild->BroadcastEvent(GE_SIGNED_OFF, _player->GetObjectGuid(), _player->GetName());
+            guild->SetMemberOffline(_player->GetObjectGuid());
         }
 
         ///- Remove pet
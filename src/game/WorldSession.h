@@ -136,6 +136,9 @@ class MANGOS_DLL_SPEC WorldSession
         void SizeError(WorldPacket const& packet, uint32 size) const;
 
         void SendPacket(WorldPacket const* packet);
+        // monster move packets are collected and sent as one SMSG_COMPRESSED_MOVES at the end of the map update
+        void QueueMonsterMove(WorldPacket const* packet);
+        void SendQueuedMonsterMoves();
         void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(int32 string_id, ...);
         void SendPetNameInvalid(uint32 error, const std::string& name);
@@ -669,6 +672,8 @@ class MANGOS_DLL_SPEC WorldSession
         void LogUnexpectedOpcode(WorldPacket* packet, const char* reason);
         void LogUnprocessedTail(WorldPacket* packet);
 
+        void SendQueuedMonsterMovesUncompressed();
+
         Player* _player;
         WorldSocket* m_Socket;
         std::string m_Address;
@@ -689,6 +694,8 @@ class MANGOS_DLL_SPEC WorldSession
         uint32 m_Tutorials[8];
         TutorialDataState m_tutorialState;
         ACE_Based::LockedQueue<WorldPacket*, ACE_Thread_Mutex> _recvQueue;
+        ByteBuffer m_monsterMoves;                          // uint8 size, uint16 opcode, payload per queued packet, kept allocated between updates
+        uint32 m_monsterMoveCount;
 		uint32 expireTime;
 		bool forceExit;
 };
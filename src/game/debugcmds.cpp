@@ -32,6 +32,9 @@
 #include "ObjectMgr.h"
 #include "ObjectGuid.h"
 #include "SpellMgr.h"
+#include "Spell.h"
+#include "movement/MoveSpline.h"
+#include "movement/MoveSplineBatch.h"
 
 bool ChatHandler::HandleDebugSendSpellFailCommand(char* args)
 {
@@ -1106,3 +1109,156 @@ bool ChatHandler::HandleDebugSpellModsCommand(char* args)
 
     return true;
 }
+
+bool ChatHandler::HandleDebugStatUpdatesCommand(char* /*args*/)
+{
+    Unit* unit = getSelectedUnit();
+    if (!unit)
+        unit = m_session->GetPlayer();
+
+    uint32 requested = unit->GetStatUpdatesRequested();
+    uint32 done = unit->GetStatUpdatesDone();
+
+    PSendSysMessage("Stat updates of %s: %u requested, %u computed, %u skipped.",
+                    unit->GetName(), requested, done, requested > done ? requested - done : 0);
+    return true;
+}
+
+bool ChatHandler::HandleDebugSplineBenchCommand(char* args)
+{
+    uint32 count;
+    if (!ExtractOptUInt32(&args, count, 5000) || !count)
+        return false;
+
+    uint32 rounds;
+    if (!ExtractOptUInt32(&args, rounds, 100) || !rounds)
+        return false;
+
+    // cyclic paths never finish, every second one is smooth like the paths of flying creatures
+    std::vector<Movement::MoveSpline> splines(count);
+    for (uint32 i = 0; i < count; ++i)
+    {
+        Movement::MoveSplineInitArgs init;
+        for (int p = 0; p < 8; ++p)
+            init.path.push_back(G3D::Vector3(frand(-100.0f, 100.0f), frand(-100.0f, 100.0f), frand(0.0f, 20.0f)));
+        init.flags.cyclic = true;
+        init.flags.flying = (i % 2) != 0;
+        init.velocity = 7.0f;
+        init.splineId = i + 1;
+        splines[i].Initialize(init);
+    }
+
+    Movement::MoveSplineBatch batch;
+    std::vector<Movement::Location> single(count);
+    std::vector<Movement::Location> batched(count);
+    uint32 singleTime = 0;
+    uint32 batchTime = 0;
+    float maxDiff = 0.0f;
+
+    for (uint32 r = 0; r < rounds; ++r)
+    {
+        // same cadence as Unit::UpdateSplineMovement position updates
+        for (uint32 i = 0; i < count; ++i)
+            splines[i].updateState(400);
+
+        uint32 startTime = WorldTimer::getMSTime();
+        for (uint32 i = 0; i < count; ++i)
+            single[i] = splines[i].ComputePosition();
+        singleTime += WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+
+        startTime = WorldTimer::getMSTime();
+        for (uint32 i = 0; i < count; ++i)
+            batch.Add(splines[i]);
+        batch.Evaluate();
+        for (uint32 i = 0; i < count; ++i)
+        {
+            G3D::Vector3 c;
+            float orientation;
+            batch.GetResult(i, c, orientation);
+            batched[i] = splines[i].ComputePosition(c, orientation);
+        }
+        batch.Clear();
+        batchTime += WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+
+        for (uint32 i = 0; i < count; ++i)
+            maxDiff = std::max(maxDiff, (static_cast<G3D::Vector3 const&>(batched[i]) - single[i]).length());
+    }
+
+    PSendSysMessage("%u splines, %u position updates each: %u ms one by one, %u ms batched, largest difference %f yards.",
+                    count, rounds, singleTime, batchTime, maxDiff);
+    return true;
+}
+
+bool ChatHandler::HandleDebugCastBenchCommand(char* args)
+{
+    uint32 count;
+    if (!ExtractOptUInt32(&args, count, 100000) || !count)
+        return false;
+
+    Player* caster = m_session->GetPlayer();
+
+    // self cast auras, the cast checks only read the caster state
+    std::vector<SpellEntry const*> spells;
+    for (uint32 id = 0; id < sSpellStore.GetNumRows(); ++id)
+    {
+        SpellEntry const* spellInfo = sSpellStore.LookupEntry(id);
+        if (!spellInfo || !IsSpellHaveEffect(spellInfo, SPELL_EFFECT_APPLY_AURA))
+            continue;
+
+        bool selfAura = true;
+        for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
+        {
+            if (spellInfo->Effect[i] != SPELL_EFFECT_NONE && (spellInfo->Effect[i] != SPELL_EFFECT_APPLY_AURA ||
+                    spellInfo->EffectImplicitTargetA[i] != TARGET_SELF || spellInfo->EffectImplicitTargetB[i] != TARGET_NONE))
+                selfAura = false;
+        }
+
+        if (selfAura)
+            spells.push_back(spellInfo);
+    }
+
+    if (spells.empty())
+    {
+        SendSysMessage("No self cast aura spells found.");
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    // derive the plan from SpellEntry at each cast, as done before the plans were built at load
+    uint32 derivedChecks = 0;
+    uint32 startTime = WorldTimer::getMSTime();
+    for (uint32 i = 0; i < count; ++i)
+    {
+        SpellExecutionPlan plan;
+        sSpellMgr.FillSpellExecutionPlan(spells[i % spells.size()], plan);
+        derivedChecks += plan.castChecks + plan.targetFill[EFFECT_INDEX_0];
+    }
+    uint32 deriveTime = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+
+    uint32 loadedChecks = 0;
+    startTime = WorldTimer::getMSTime();
+    for (uint32 i = 0; i < count; ++i)
+    {
+        SpellExecutionPlan const* plan = sSpellMgr.GetSpellExecutionPlan(spells[i % spells.size()]->Id);
+        loadedChecks += plan->castChecks + plan->targetFill[EFFECT_INDEX_0];
+    }
+    uint32 lookupTime = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+
+    // synthetic casts by the command user, checked but never prepared
+    uint32 passed = 0;
+    startTime = WorldTimer::getMSTime();
+    for (uint32 i = 0; i < count; ++i)
+    {
+        Spell* spell = new Spell(caster, spells[i % spells.size()], false);
+        spell->m_targets.setUnitTarget(caster);
+        if (spell->CheckCast(true) == SPELL_CAST_OK)
+            ++passed;
+        delete spell;
+    }
+    uint32 castTime = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+
+    PSendSysMessage("%u casts of %u self cast auras: plans derived in %u ms, looked up in %u ms (%s), cast checks in %u ms (%u passed).",
+                    count, uint32(spells.size()), deriveTime, lookupTime, derivedChecks == loadedChecks ? "same" : "different",
+                    castTime, passed);
+    return true;
+}
@@ -28,16 +28,34 @@ namespace Movement
     extern float computeFallElevation(float time_passed, bool isSafeFall, float start_velocy);
     extern float computeFallElevation(float time_passed);
 
-    Location MoveSpline::ComputePosition() const
+    float MoveSpline::computeSegmentPercent() const
     {
-        MANGOS_ASSERT(Initialized());
-
         float u = 1.f;
         int32 seg_time = spline.length(point_Idx, point_Idx + 1);
         if (seg_time > 0)
             u = (time_passed - spline.length(point_Idx)) / (float)seg_time;
-        Location c;
-        spline.evaluate_percent(point_Idx, u, c);
+        return u;
+    }
+
+    Location MoveSpline::ComputePosition() const
+    {
+        MANGOS_ASSERT(Initialized());
+
+        Vector3 c, hermite;
+        spline.evaluate_percent_and_derivative(point_Idx, computeSegmentPercent(), c, hermite);
+        return ComputePosition(c, atan2(hermite.y, hermite.x));
+    }
+
+    void MoveSpline::ComputePositionTerms(Vector3 (&controls)[4], float (&weights)[4], float (&dweights)[4]) const
+    {
+        MANGOS_ASSERT(Initialized());
+
+        spline.evaluate_terms(point_Idx, computeSegmentPercent(), controls, weights, dweights);
+    }
+
+    Location MoveSpline::ComputePosition(const Vector3& position, float orientation) const
+    {
+        Location c(position, orientation);
 
         if (splineflags.falling)
             computeFallElevation(c.z);
@@ -48,13 +66,8 @@ namespace Movement
                 c.orientation = facing.angle;
             else if (splineflags.final_point)
                 c.orientation = atan2(facing.f.y - c.y, facing.f.x - c.x);
-            // nothing to do for MoveSplineFlag::Final_Target flag
-        }
-        else
-        {
-            Vector3 hermite;
-            spline.evaluate_derivative(point_Idx, u, hermite);
-            c.orientation = atan2(hermite.y, hermite.x);
+            else                                            // nothing to do for MoveSplineFlag::Final_Target flag
+                c.orientation = 0.f;
         }
         return c;
     }
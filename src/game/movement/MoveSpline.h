@@ -76,6 +76,7 @@ namespace Movement
 
             const MySpline::ControlArray& getPath() const { return spline.getPoints();}
             void computeFallElevation(float& el) const;
+            float computeSegmentPercent() const;
 
             UpdateResult _updateState(int32& ms_time_diff);
             int32 next_timestamp() const { return spline.length(point_Idx + 1);}
@@ -114,6 +115,11 @@ namespace Movement
 
             Location ComputePosition() const;
 
+            /** Segment terms of the current position, see SplineBase::evaluate_terms and MoveSplineBatch
+                the evaluated position and orientation along the derivation are finished by ComputePosition(c, orientation) */
+            void ComputePositionTerms(Vector3 (&controls)[4], float (&weights)[4], float (&dweights)[4]) const;
+            Location ComputePosition(const Vector3& c, float orientation) const;
+
             uint32 GetId() const { return m_Id;}
             bool Finalized() const { return splineflags.done; }
             bool isCyclic() const { return splineflags.cyclic;}
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "MoveSplineBatch.h"
+#include "MoveSpline.h"
+#include <cmath>
+#include <algorithm>
+
+namespace Movement
+{
+    void MoveSplineBatch::Add(const MoveSpline& spline)
+    {
+        if (m_count == m_weights[0].size())
+            Grow();
+
+        Vector3 controls[4];
+        float weights[4], dweights[4];
+        spline.ComputePositionTerms(controls, weights, dweights);
+
+        uint32 i = m_count++;
+        for (int k = 0; k < 4; ++k)
+        {
+            m_controls[0][k][i] = controls[k].x;
+            m_controls[1][k][i] = controls[k].y;
+            m_controls[2][k][i] = controls[k].z;
+            m_weights[k][i] = weights[k];
+            m_dweights[k][i] = dweights[k];
+        }
+    }
+
+    void MoveSplineBatch::Grow()
+    {
+        size_t capacity = m_count < 256 ? 256 : m_count * 2;
+
+        for (int k = 0; k < 4; ++k)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+                m_controls[axis][k].resize(capacity);
+            m_weights[k].resize(capacity);
+            m_dweights[k].resize(capacity);
+        }
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            m_position[axis].resize(capacity);
+            m_derivative[axis].resize(capacity);
+        }
+
+        m_orientation.resize(capacity);
+    }
+
+    // atan2 without branches, so the loop over all entries is vectorized; error about 2e-6 radians
+    // result in [-pi, pi] like atan2, 0 for a zero vector
+    inline float BatchAtan2(float y, float x)
+    {
+        float ax = std::fabs(x);
+        float ay = std::fabs(y);
+        float hi = std::max(ax, ay);
+        float lo = std::min(ax, ay);
+        float a = lo / std::max(hi, 1e-30f);                // in [0, 1]
+        float s = a * a;
+
+        // minimax polynomial of atan on [0, 1]
+        float r = ((((-0.0117212f * s + 0.05265332f) * s - 0.11643287f) * s + 0.19354346f) * s - 0.33262347f) * s + 0.99997726f;
+        r *= a;
+
+        // octant corrections as arithmetic, conditional assignments keep GCC from vectorizing
+        float steep = ay > ax ? 1.f : 0.f;
+        r += steep * (1.57079637f - 2.f * r);
+        float back = x < 0.f ? 1.f : 0.f;
+        r += back * (3.14159274f - 2.f * r);
+        return std::copysign(r, y);
+    }
+
+    void MoveSplineBatch::Evaluate()
+    {
+        uint32 count = Size();
+        if (!count)
+            return;
+
+        const float* w0 = &m_weights[0][0];
+        const float* w1 = &m_weights[1][0];
+        const float* w2 = &m_weights[2][0];
+        const float* w3 = &m_weights[3][0];
+        const float* d0 = &m_dweights[0][0];
+        const float* d1 = &m_dweights[1][0];
+        const float* d2 = &m_dweights[2][0];
+        const float* d3 = &m_dweights[3][0];
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float* c0 = &m_controls[axis][0][0];
+            const float* c1 = &m_controls[axis][1][0];
+            const float* c2 = &m_controls[axis][2][0];
+            const float* c3 = &m_controls[axis][3][0];
+            float* position = &m_position[axis][0];
+            float* derivative = &m_derivative[axis][0];
+
+            // no branches and no dependencies between entries, one SIMD lane per spline
+            // separate loops keep the aliasing checks the compiler adds for vectorizing small
+            for (uint32 i = 0; i < count; ++i)
+                position[i] = c0[i] * w0[i] + c1[i] * w1[i] + c2[i] * w2[i] + c3[i] * w3[i];
+
+            for (uint32 i = 0; i < count; ++i)
+                derivative[i] = c0[i] * d0[i] + c1[i] * d1[i] + c2[i] * d2[i] + c3[i] * d3[i];
+        }
+
+        const float* dx = &m_derivative[0][0];
+        const float* dy = &m_derivative[1][0];
+        float* orientation = &m_orientation[0];
+        for (uint32 i = 0; i < count; ++i)
+            orientation[i] = BatchAtan2(dy[i], dx[i]);
+    }
+
+    void MoveSplineBatch::GetResult(uint32 i, Vector3& c, float& orientation) const
+    {
+        c = Vector3(m_position[0][i], m_position[1][i], m_position[2][i]);
+        orientation = m_orientation[i];
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOSSERVER_MOVESPLINEBATCH_H
+#define MANGOSSERVER_MOVESPLINEBATCH_H
+
+#include "typedefs.h"
+#include <vector>
+
+namespace Movement
+{
+    class MoveSpline;
+
+    // Current positions of many splines evaluated in one pass. Control points and weights are kept
+    // as structure of arrays, so the weighted sums run over plain float arrays the compiler vectorizes.
+    class MoveSplineBatch
+    {
+        public:
+            /// queues the current position of spline, the index of the entry is the number of queued entries before it
+            void Add(const MoveSpline& spline);
+
+            /// evaluates positions, derivations and orientations of all queued entries
+            void Evaluate();
+
+            /// position and the orientation along the derivation of entry i, valid after Evaluate
+            void GetResult(uint32 i, Vector3& c, float& orientation) const;
+
+            MoveSplineBatch() : m_count(0) {}
+
+            uint32 Size() const { return m_count; }
+            void Clear() { m_count = 0; }                   // capacity is kept for the next map update
+
+        private:
+            void Grow();
+
+            uint32 m_count;
+            std::vector<float> m_controls[3][4];            // per axis and control point, sized to the capacity
+            std::vector<float> m_weights[4];
+            std::vector<float> m_dweights[4];
+            std::vector<float> m_position[3];               // per axis
+            std::vector<float> m_derivative[3];
+            std::vector<float> m_orientation;
+    };
+}
+#endif // MANGOSSERVER_MOVESPLINEBATCH_H
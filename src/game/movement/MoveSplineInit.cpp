@@ -20,6 +20,8 @@
 #include "MoveSpline.h"
 #include "packet_builder.h"
 #include "Unit.h"
+#include "Map.h"
+#include "World.h"
 
 namespace Movement
 {
@@ -43,6 +45,15 @@ namespace Movement
         return MOVE_RUN;
     }
 
+    // players get own moves at once, creature moves are batched per viewer until the end of the map update
+    static void SendMonsterMove(Unit& unit, WorldPacket& data)
+    {
+        if (unit.GetTypeId() != TYPEID_PLAYER && unit.IsInWorld() && sWorld.getConfig(CONFIG_BOOL_BATCH_MONSTER_MOVES))
+            unit.GetMap()->MonsterMoveBroadcast(&unit, &data);
+        else
+            unit.SendMessageToSet(&data, true);
+    }
+
     int32 MoveSplineInit::Launch()
     {
         MoveSpline& move_spline = *unit.movespline;
@@ -81,7 +92,7 @@ namespace Movement
         WorldPacket data(SMSG_MONSTER_MOVE, 64);
         data << unit.GetPackGUID();
         PacketBuilder::WriteMonsterMove(move_spline, data);
-        unit.SendMessageToSet(&data, true);
+        SendMonsterMove(unit, data);
 
         return move_spline.Duration();
     }
@@ -134,7 +145,7 @@ namespace Movement
         data << real_position.x << real_position.y << real_position.z;
         data << move_spline.GetId();
         data << uint8(MonsterMoveStop);
-        unit.SendMessageToSet(&data, true);
+        SendMonsterMove(unit, data);
     }
 
     MoveSplineInit::MoveSplineInit(Unit& m) : unit(m)
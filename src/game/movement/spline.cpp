@@ -39,6 +39,14 @@ namespace Movement
         (EvaluationMethtod)& SplineBase::UninitializedSpline,
     };
 
+    SplineBase::EvaluationBothMethtod SplineBase::both_evaluators[SplineBase::ModesEnd] =
+    {
+        &SplineBase::EvaluateBothLinear,
+        &SplineBase::EvaluateBothCatmullRom,
+        &SplineBase::EvaluateBothBezier3,
+        &SplineBase::UninitializedSplineBoth,
+    };
+
     SplineBase::SegLenghtMethtod SplineBase::seglengths[SplineBase::ModesEnd] =
     {
         &SplineBase::SegLengthLinear,
@@ -114,6 +122,73 @@ namespace Movement
                  + vertice[2] * weights[2] + vertice[3] * weights[3];
     }
 
+    // position and derivative in one pass, weights are taken from the matrix columns directly
+    inline void C_Evaluate_Both(const Vector3* vertice, float t, const Matrix4& matr, Vector3& position, Vector3& derivative)
+    {
+        float t2 = t * t;
+        float t3 = t2 * t;
+
+        position = Vector3::zero();
+        derivative = Vector3::zero();
+        for (int i = 0; i < 4; ++i)
+        {
+            float weight = matr[0][i] * t3 + matr[1][i] * t2 + matr[2][i] * t + matr[3][i];
+            float dweight = matr[0][i] * 3.f * t2 + matr[1][i] * 2.f * t + matr[2][i];
+
+            position += vertice[i] * weight;
+            derivative += vertice[i] * dweight;
+        }
+    }
+
+    // weights of C_Evaluate_Both
+    inline void C_Weights(float t, const Matrix4& matr, float (&weights)[4], float (&dweights)[4])
+    {
+        float t2 = t * t;
+        float t3 = t2 * t;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            weights[i] = matr[0][i] * t3 + matr[1][i] * t2 + matr[2][i] * t + matr[3][i];
+            dweights[i] = matr[0][i] * 3.f * t2 + matr[1][i] * 2.f * t + matr[2][i];
+        }
+    }
+
+    void SplineBase::evaluate_terms(index_type index, float u, Vector3 (&controls)[4], float (&weights)[4], float (&dweights)[4]) const
+    {
+        switch (m_mode)
+        {
+            case ModeLinear:
+            {
+                MANGOS_ASSERT(index >= index_lo && index < index_hi);
+                // only two points are used, the others get zero weights
+                controls[0] = points[index];
+                controls[1] = controls[2] = controls[3] = points[index + 1];
+                weights[0] = 1.f - u;
+                weights[1] = u;
+                dweights[0] = -1.f;
+                dweights[1] = 1.f;
+                weights[2] = weights[3] = dweights[2] = dweights[3] = 0.f;
+                break;
+            }
+            case ModeCatmullrom:
+                MANGOS_ASSERT(index >= index_lo && index < index_hi);
+                for (int i = 0; i < 4; ++i)
+                    controls[i] = points[index - 1 + i];
+                C_Weights(u, s_catmullRomCoeffs, weights, dweights);
+                break;
+            case ModeBezier3_Unused:
+                index *= 3u;
+                MANGOS_ASSERT(index >= index_lo && index < index_hi);
+                for (int i = 0; i < 4; ++i)
+                    controls[i] = points[index + i];
+                C_Weights(u, s_Bezier3Coeffs, weights, dweights);
+                break;
+            default:
+                UninitializedSpline();
+                break;
+        }
+    }
+
     void SplineBase::EvaluateLinear(index_type index, float u, Vector3& result) const
     {
         MANGOS_ASSERT(index >= index_lo && index < index_hi);
@@ -152,6 +227,26 @@ namespace Movement
         C_Evaluate_Derivative(&points[index], t, s_Bezier3Coeffs, result);
     }
 
+    void SplineBase::EvaluateBothLinear(index_type index, float u, Vector3& result, Vector3& hermite) const
+    {
+        MANGOS_ASSERT(index >= index_lo && index < index_hi);
+        hermite = points[index + 1] - points[index];
+        result = points[index] + hermite * u;
+    }
+
+    void SplineBase::EvaluateBothCatmullRom(index_type index, float t, Vector3& result, Vector3& hermite) const
+    {
+        MANGOS_ASSERT(index >= index_lo && index < index_hi);
+        C_Evaluate_Both(&points[index - 1], t, s_catmullRomCoeffs, result, hermite);
+    }
+
+    void SplineBase::EvaluateBothBezier3(index_type index, float t, Vector3& result, Vector3& hermite) const
+    {
+        index *= 3u;
+        MANGOS_ASSERT(index >= index_lo && index < index_hi);
+        C_Evaluate_Both(&points[index], t, s_Bezier3Coeffs, result, hermite);
+    }
+
     float SplineBase::SegLengthLinear(index_type index) const
     {
         MANGOS_ASSERT(index >= index_lo && index < index_hi);
@@ -71,6 +71,12 @@ namespace Movement
             void EvaluateDerivativeBezier3(index_type, float, Vector3&) const;
             static EvaluationMethtod derivative_evaluators[ModesEnd];
 
+            void EvaluateBothLinear(index_type, float, Vector3&, Vector3&) const;
+            void EvaluateBothCatmullRom(index_type, float, Vector3&, Vector3&) const;
+            void EvaluateBothBezier3(index_type, float, Vector3&, Vector3&) const;
+            typedef void (SplineBase::*EvaluationBothMethtod)(index_type, float, Vector3&, Vector3&) const;
+            static EvaluationBothMethtod both_evaluators[ModesEnd];
+
             float SegLengthLinear(index_type) const;
             float SegLengthCatmullRom(index_type) const;
             float SegLengthBezier3(index_type) const;
@@ -84,6 +90,7 @@ namespace Movement
             static InitMethtod initializers[ModesEnd];
 
             void UninitializedSpline() const { MANGOS_ASSERT(false);}
+            void UninitializedSplineBoth(index_type, float, Vector3&, Vector3&) const { MANGOS_ASSERT(false);}
 
         public:
 
@@ -101,6 +108,19 @@ namespace Movement
              */
             void evaluate_derivative(index_type Idx, float u, Vector3& hermite) const {(this->*derivative_evaluators[m_mode])(Idx, u, hermite);}
 
+            /** Caclulates position and derivation in index Idx at once, shares the segment lookup and weights
+                @param Idx - spline segment index, should be in range [first, last)
+                @param t  - percent of spline segment length, assumes that t in range [0, 1]
+             */
+            void evaluate_percent_and_derivative(index_type Idx, float u, Vector3& c, Vector3& hermite) const {(this->*both_evaluators[m_mode])(Idx, u, c, hermite);}
+
+            /** Control points and weights of segment Idx, the position is sum(controls[i] * weights[i]) and
+                the derivation sum(controls[i] * dweights[i]), lets callers evaluate many splines in one pass
+                @param Idx - spline segment index, should be in range [first, last)
+                @param u  - percent of spline segment length, assumes that u in range [0, 1]
+             */
+            void evaluate_terms(index_type Idx, float u, Vector3 (&controls)[4], float (&weights)[4], float (&dweights)[4]) const;
+
             /**  Bounds for spline indexes. All indexes should be in range [first, last). */
             index_type first() const { return index_lo;}
             index_type last()  const { return index_hi;}
@@ -165,6 +185,8 @@ namespace Movement
                 @param t  - percent of spline segment length, assumes that t in range [0, 1]. */
             void evaluate_derivative(index_type Idx, float u, Vector3& c) const { SplineBase::evaluate_derivative(Idx, u, c);}
 
+            void evaluate_percent_and_derivative(index_type Idx, float u, Vector3& c, Vector3& hermite) const { SplineBase::evaluate_percent_and_derivative(Idx, u, c, hermite);}
+
             // Assumes that t in range [0, 1]
             index_type computeIndexInBounds(float t) const;
             void computeIndex(float t, index_type& out_idx, float& out_u) const;
@@ -36,29 +36,10 @@ namespace Movement
 
     template<typename length_type> SplineBase::index_type Spline<length_type>::computeIndexInBounds(length_type length_) const
     {
-// Temporary disabled: causes infinite loop with t = 1.f
-        /*
-            index_type hi = index_hi;
-            index_type lo = index_lo;
-
-            index_type i = lo + (float)(hi - lo) * t;
-
-            while ((lengths[i] > length) || (lengths[i + 1] <= length))
-            {
-                if (lengths[i] > length)
-                    hi = i - 1; // too big
-                else if (lengths[i + 1] <= length)
-                    lo = i + 1; // too small
-
-                i = (hi + lo) / 2;
-            }*/
-
-        index_type i = index_lo;
-        index_type N = index_hi;
-        while (i + 1 < N && lengths[i + 1] < length_)
-            ++i;
-
-        return i;
+        // lengths are not decreasing: segment i is the one before the first node in (index_lo, index_hi) reaching length_
+        // the last segment is used for length_ at or past the last node
+        typename LengthArray::const_iterator itr = std::lower_bound(lengths.begin() + index_lo + 1, lengths.begin() + index_hi, length_);
+        return index_type(itr - lengths.begin()) - 1;
     }
 
     template<typename length_type> void Spline<length_type>::computeIndex(float t, index_type& index, float& u) const
@@ -269,6 +269,57 @@ namespace VMAP
 
     //=========================================================
 
+    bool StaticMapTree::GetMapModelNames(const std::string& basePath, uint32 mapID, std::set<std::string>& names)
+    {
+        std::string fullname = basePath + VMapManager2::getMapFileName(mapID);
+        FILE* rf = fopen(fullname.c_str(), "rb");
+        if (!rf)
+            return false;
+
+        char chunk[8];
+        char tiled;
+        bool success = readChunk(rf, chunk, VMAP_MAGIC, 8) && fread(&tiled, sizeof(char), 1, rf) == 1;
+        if (success && !tiled)
+        {
+            // the only spawn of a non-tiled map is stored after the tree
+            BIH tree;
+            ModelSpawn spawn;
+            success = readChunk(rf, chunk, "NODE", 4) && tree.readFromFile(rf) && readChunk(rf, chunk, "GOBJ", 4);
+            if (success && ModelSpawn::readFromFile(rf, spawn))
+                names.insert(spawn.name);
+        }
+        fclose(rf);
+
+        if (!success || !tiled)
+            return success;
+
+        for (uint32 tileX = 0; tileX < 64; ++tileX)
+        {
+            for (uint32 tileY = 0; tileY < 64; ++tileY)
+            {
+                FILE* tf = fopen((basePath + getTileFileName(mapID, tileX, tileY)).c_str(), "rb");
+                if (!tf)
+                    continue;
+
+                uint32 numSpawns;
+                bool result = readChunk(tf, chunk, VMAP_MAGIC, 8) && fread(&numSpawns, sizeof(uint32), 1, tf) == 1;
+                for (uint32 i = 0; i < numSpawns && result; ++i)
+                {
+                    ModelSpawn spawn;
+                    uint32 referencedVal;
+                    result = ModelSpawn::readFromFile(tf, spawn) && fread(&referencedVal, sizeof(uint32), 1, tf) == 1;
+                    if (result)
+                        names.insert(spawn.name);
+                }
+                fclose(tf);
+            }
+        }
+
+        return true;
+    }
+
+    //=========================================================
+
     bool StaticMapTree::InitMap(const std::string& fname, VMapManager2* vm)
     {
         DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Initializing StaticMapTree '%s'", fname.c_str());
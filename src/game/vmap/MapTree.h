@@ -23,6 +23,8 @@
 #include "Utilities/UnorderedMapSet.h"
 #include "BIH.h"
 
+#include <set>
+
 namespace VMAP
 {
     class ModelInstance;
@@ -64,6 +66,8 @@ namespace VMAP
             static uint32 packTileID(uint32 tileX, uint32 tileY) { return tileX << 16 | tileY; }
             static void unpackTileID(uint32 ID, uint32& tileX, uint32& tileY) { tileX = ID >> 16; tileY = ID & 0xFF; }
             static bool CanLoadMap(const std::string& basePath, uint32 mapID, uint32 tileX, uint32 tileY);
+            // collects the names of all models spawned on the map, basePath must end with a path separator
+            static bool GetMapModelNames(const std::string& basePath, uint32 mapID, std::set<std::string>& names);
 
             StaticMapTree(uint32 mapID, const std::string& basePath);
             ~StaticMapTree();
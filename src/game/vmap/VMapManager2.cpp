@@ -246,28 +246,77 @@ namespace VMAP
 
     //=========================================================
 
+    uint32 VMapManager2::preloadMapModels(const char* pBasePath, unsigned int pMapId)
+    {
+        std::string basePath = pBasePath;
+        if (basePath.length() > 0 && basePath[basePath.length() - 1] != '/' && basePath[basePath.length() - 1] != '\\')
+            basePath.append("/");
+
+        std::set<std::string> names;
+        if (!StaticMapTree::GetMapModelNames(basePath, pMapId, names))
+        {
+            ERROR_LOG("VMapManager2: could not read model spawns of map %u for preloading!", pMapId);
+            return 0;
+        }
+
+        uint32 count = 0;
+        for (std::set<std::string>::const_iterator itr = names.begin(); itr != names.end(); ++itr)
+        {
+            if (!acquireModelInstance(basePath, *itr))
+                continue;
+
+            GuardType guard(iModelFilesLock);
+            iPreloadedModelFiles.push_back(*itr);
+            ++count;
+        }
+
+        return count;
+    }
+
+    //=========================================================
+
     WorldModel* VMapManager2::acquireModelInstance(const std::string& basepath, const std::string& filename)
     {
-        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
-        if (model == iLoadedModelFiles.end())
         {
-            WorldModel* worldmodel = new WorldModel();
-            if (!worldmodel->readFile(basepath + filename + ".vmo"))
+            GuardType guard(iModelFilesLock);
+
+            ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
+            if (model != iLoadedModelFiles.end())
             {
-                ERROR_LOG("VMapManager2: could not load '%s%s.vmo'!", basepath.c_str(), filename.c_str());
-                delete worldmodel;
-                return NULL;
+                model->second.incRefCount();
+                return model->second.getModel();
             }
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "VMapManager2: loading file '%s%s'.", basepath.c_str(), filename.c_str());
+        }
+
+        // read the file without holding the lock, other threads keep using already loaded models
+        WorldModel* worldmodel = new WorldModel();
+        if (!worldmodel->readFile(basepath + filename + ".vmo"))
+        {
+            ERROR_LOG("VMapManager2: could not load '%s%s.vmo'!", basepath.c_str(), filename.c_str());
+            delete worldmodel;
+            return NULL;
+        }
+        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "VMapManager2: loading file '%s%s'.", basepath.c_str(), filename.c_str());
+
+        GuardType guard(iModelFilesLock);
+
+        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
+        if (model == iLoadedModelFiles.end())
+        {
             model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
             model->second.setModel(worldmodel);
         }
+        else
+            delete worldmodel;                              // loaded by another thread meanwhile
+
         model->second.incRefCount();
         return model->second.getModel();
     }
 
     void VMapManager2::releaseModelInstance(const std::string& filename)
     {
+        GuardType guard(iModelFilesLock);
+
         ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
         if (model == iLoadedModelFiles.end())
         {
@@ -23,6 +23,14 @@
 #include "Utilities/UnorderedMapSet.h"
 #include "Platform/Define.h"
 #include <G3D/Vector3.h>
+#include <vector>
+
+#include <ace/Guard_T.h>
+#ifndef NO_CORE_FUNCS
+#include <ace/Thread_Mutex.h>
+#else
+#include <ace/Null_Mutex.h>
+#endif
 
 //===========================================================
 
@@ -67,6 +75,17 @@ namespace VMAP
             // Tree to check collision
             ModelFileMap iLoadedModelFiles;
             InstanceTreeMap iInstanceMapTrees;
+            // models referenced by preloadMapModels, never released
+            std::vector<std::string> iPreloadedModelFiles;
+
+            // tiles of different maps are loaded from several map threads and share models
+#ifndef NO_CORE_FUNCS
+            typedef ACE_Thread_Mutex LockType;
+#else
+            typedef ACE_Null_Mutex LockType;
+#endif
+            typedef ACE_Guard<LockType> GuardType;
+            LockType iModelFilesLock;
 
             bool _loadMap(uint32 pMapId, const std::string& basePath, uint32 tileX, uint32 tileY);
             /* void _unloadMap(uint32 pMapId, uint32 x, uint32 y); */
@@ -84,6 +103,8 @@ namespace VMAP
             void unloadMap(unsigned int pMapId, int x, int y) override;
             void unloadMap(unsigned int pMapId) override;
 
+            uint32 preloadMapModels(const char* pBasePath, unsigned int pMapId) override;
+
             bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2) override;
             /**
             fill the hit pos and return true, if an object was hit
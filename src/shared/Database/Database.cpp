@@ -96,7 +96,7 @@ Database::~Database()
     StopServer();
 }
 
-bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
+bool Database::Initialize(const char* infoString, int nConns /*= 1*/, int nHolderConns /*= 0*/)
 {
     // Enable logging of SQL commands (usually only GM commands)
     // (See method: PExecuteLog)
@@ -109,6 +109,7 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
     }
 
     m_pingIntervallms = sConfig.GetIntDefault("MaxPingTime", 30) * (MINUTE * 1000);
+    m_bBinaryResults = sConfig.GetBoolDefault("BinaryQueryResults", false);
 
     // create DB connections
 
@@ -138,6 +139,22 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
     if (!m_pAsyncConn->Initialize(infoString))
         return false;
 
+    // create connections for parallel query holder execution
+    if (nHolderConns > MAX_CONNECTION_POOL_SIZE)
+        nHolderConns = MAX_CONNECTION_POOL_SIZE;
+
+    for (int i = 0; i < nHolderConns; ++i)
+    {
+        SqlConnection* pConn = CreateConnection();
+        if (!pConn->Initialize(infoString))
+        {
+            delete pConn;
+            return false;
+        }
+
+        m_pHolderConnections.push_back(pConn);
+    }
+
     m_pResultQueue = new SqlResultQueue;
 
     InitDelayThread();
@@ -158,6 +175,11 @@ void Database::StopServer()
         delete m_pQueryConnections[i];
 
     m_pQueryConnections.clear();
+
+    for (size_t i = 0; i < m_pHolderConnections.size(); ++i)
+        delete m_pHolderConnections[i];
+
+    m_pHolderConnections.clear();
 }
 
 SqlDelayThread* Database::CreateDelayThread()
@@ -166,10 +188,23 @@ SqlDelayThread* Database::CreateDelayThread()
     return new SqlDelayThread(this, m_pAsyncConn);
 }
 
+SqlDelayThread* Database::CreateHolderThread(SqlConnection* conn)
+{
+    return new SqlHolderThread(this, conn);
+}
+
 void Database::InitDelayThread()
 {
     assert(!m_delayThread);
 
+    // holder threads are started first, the delay thread hands them work
+    for (size_t i = 0; i < m_pHolderConnections.size(); ++i)
+    {
+        SqlDelayThread* body = CreateHolderThread(m_pHolderConnections[i]);
+        m_holderThreadBodies.push_back(body);
+        m_holderThreads.push_back(new ACE_Based::Thread(body));
+    }
+
     // New delay thread for delay execute
     m_threadBody = CreateDelayThread();              // will deleted at m_delayThread delete
     m_delayThread = new ACE_Based::Thread(m_threadBody);
@@ -184,6 +219,17 @@ void Database::HaltDelayThread()
     delete m_delayThread;                                   // This also deletes m_threadBody
     m_delayThread = NULL;
     m_threadBody = NULL;
+
+    // the delay thread may still have used holder threads while flushing
+    for (size_t i = 0; i < m_holderThreads.size(); ++i)
+    {
+        m_holderThreadBodies[i]->Stop();
+        m_holderThreads[i]->wait();
+        delete m_holderThreads[i];
+    }
+
+    m_holderThreads.clear();
+    m_holderThreadBodies.clear();
 }
 
 void Database::ThreadStart()
@@ -238,6 +284,12 @@ void Database::Ping()
         SqlConnection::Lock guard(m_pQueryConnections[i]);
         delete guard->Query(sql);
     }
+
+    for (size_t i = 0; i < m_pHolderConnections.size(); ++i)
+    {
+        SqlConnection::Lock guard(m_pHolderConnections[i]);
+        delete guard->Query(sql);
+    }
 }
 
 bool Database::PExecuteLog(const char* format, ...)
@@ -303,6 +355,25 @@ QueryResult* Database::PQuery(const char* format, ...)
     return Query(szQuery);
 }
 
+QueryResult* Database::PQueryStream(const char* format, ...)
+{
+    if (!format) return NULL;
+
+    va_list ap;
+    char szQuery [MAX_QUERY_LEN];
+    va_start(ap, format);
+    int res = vsnprintf(szQuery, MAX_QUERY_LEN, format, ap);
+    va_end(ap);
+
+    if (res == -1)
+    {
+        sLog.outError("SQL Query truncated (and not execute) for format: %s", format);
+        return NULL;
+    }
+
+    return QueryStream(szQuery);
+}
+
 QueryNamedResult* Database::PQueryNamed(const char* format, ...)
 {
     if (!format) return NULL;
@@ -48,6 +48,8 @@ class MANGOS_DLL_SPEC SqlConnection
         // public methods for making queries
         virtual QueryResult* Query(const char* sql) = 0;
         virtual QueryNamedResult* QueryNamed(const char* sql) = 0;
+        // rows fetched from server while iterating, connection stays locked until result end or delete
+        virtual QueryResult* QueryStream(const char* sql) { return Query(sql); }
 
         // public methods for making requests
         virtual bool Execute(const char* sql) = 0;
@@ -105,7 +107,8 @@ class MANGOS_DLL_SPEC Database
     public:
         virtual ~Database();
 
-        virtual bool Initialize(const char* infoString, int nConns = 1);
+        // nHolderConns extra connections let query holders run their queries in parallel
+        virtual bool Initialize(const char* infoString, int nConns = 1, int nHolderConns = 0);
         // start worker thread for async DB request execution
         virtual void InitDelayThread();
         // stop worker thread
@@ -127,6 +130,16 @@ class MANGOS_DLL_SPEC Database
         QueryResult* PQuery(const char* format, ...) ATTR_PRINTF(2, 3);
         QueryNamedResult* PQueryNamed(const char* format, ...) ATTR_PRINTF(2, 3);
 
+        /// Synchronous DB queries for big tables, rows are not stored at client side but read one by one at NextRow()
+        /// GetRowCount() is unknown (0) for such results, and no other query must be done on the database while iterating
+        inline QueryResult* QueryStream(const char* sql)
+        {
+            SqlConnection::Lock guard(getQueryConnection());
+            return guard->QueryStream(sql);
+        }
+
+        QueryResult* PQueryStream(const char* format, ...) ATTR_PRINTF(2, 3);
+
         inline bool DirectExecute(const char* sql)
         {
             if (!m_pAsyncConn)
@@ -221,10 +234,13 @@ class MANGOS_DLL_SPEC Database
         // NO ASYNC TRANSACTIONS DURING SERVER STARTUP - ONLY DURING RUNTIME!!!
         void AllowAsyncTransactions() { m_bAllowAsyncTransactions = true; }
 
+        // fetch query results by binary protocol if DBMS support it (see mangosd.conf "BinaryQueryResults")
+        bool IsBinaryResults() const { return m_bBinaryResults; }
+
     protected:
         Database() :
             m_nQueryConnPoolSize(1), m_pAsyncConn(NULL), m_pResultQueue(NULL),
-            m_threadBody(NULL), m_delayThread(NULL), m_bAllowAsyncTransactions(false),
+            m_threadBody(NULL), m_delayThread(NULL), m_bAllowAsyncTransactions(false), m_bBinaryResults(false),
             m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0)
         {
             m_nQueryCounter = -1;
@@ -236,6 +252,8 @@ class MANGOS_DLL_SPEC Database
         virtual SqlConnection* CreateConnection() = 0;
         // factory method to create SqlDelayThread objects
         virtual SqlDelayThread* CreateDelayThread();
+        // factory method to create SqlDelayThread objects executing query holder parts
+        virtual SqlDelayThread* CreateHolderThread(SqlConnection* conn);
 
         class MANGOS_DLL_SPEC TransHelper
         {
@@ -270,6 +288,7 @@ class MANGOS_DLL_SPEC Database
         SqlConnection* getAsyncConnection() const { return m_pAsyncConn; }
 
         friend class SqlStatement;
+        friend class SqlQueryHolderEx;
         // PREPARED STATEMENT API
         // query function for prepared statements
         bool ExecuteStmt(const SqlStatementID& id, SqlStmtParameters* params);
@@ -290,7 +309,13 @@ class MANGOS_DLL_SPEC Database
         SqlDelayThread*     m_threadBody;                   ///< Pointer to delay sql executer (owned by m_delayThread)
         ACE_Based::Thread* m_delayThread;                   ///< Pointer to executer thread
 
+        // connections and threads executing query holder parts next to the delay thread
+        SqlConnectionContainer m_pHolderConnections;
+        std::vector<SqlDelayThread*> m_holderThreadBodies;  ///< owned by m_holderThreads
+        std::vector<ACE_Based::Thread*> m_holderThreads;
+
         bool m_bAllowAsyncTransactions;                     ///< flag which specifies if async transactions are enabled
+        bool m_bBinaryResults;                              ///< flag which specifies if results are fetched already converted
 
         // PREPARED STATEMENT REGISTRY
         typedef ACE_Thread_Mutex LOCK_TYPE;
@@ -174,9 +174,20 @@ bool MySQLConnection::Initialize(const char* infoString)
     return true;
 }
 
+bool MySQLConnection::_IsStreaming(const char* sql) const
+{
+    if (!mStreamLock)
+        return false;
+
+    // same thread started other query before end of streamed result, connection can't process it
+    sLog.outErrorDb("SQL: %s", sql);
+    sLog.outErrorDb("query ERROR: connection is busy with not finished streamed result");
+    return true;
+}
+
 bool MySQLConnection::_Query(const char* sql, MYSQL_RES** pResult, MYSQL_FIELD** pFields, uint64* pRowCount, uint32* pFieldCount)
 {
-    if (!mMysql)
+    if (!mMysql || _IsStreaming(sql))
         return 0;
 
     uint32 _s = WorldTimer::getMSTime();
@@ -209,8 +220,90 @@ bool MySQLConnection::_Query(const char* sql, MYSQL_RES** pResult, MYSQL_FIELD**
     return true;
 }
 
+bool MySQLConnection::_QueryStmt(const char* sql, QueryResult** pResult, QueryFieldNames* pNames)
+{
+    *pResult = NULL;
+
+    if (!mMysql || _IsStreaming(sql))
+        return false;
+
+    MYSQL_STMT* stmt = mysql_stmt_init(mMysql);
+    if (!stmt)
+        return false;
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    // statements not supported by binary protocol or without result set go by text protocol, errors reported there
+    if (mysql_stmt_prepare(stmt, sql, strlen(sql)))
+    {
+        mysql_stmt_close(stmt);
+        return false;
+    }
+
+    MYSQL_RES* metadata = mysql_stmt_result_metadata(stmt);
+    if (!metadata)
+    {
+        mysql_stmt_close(stmt);
+        return false;
+    }
+
+    // let store result calculate max_length of columns for text buffers
+    my_bool updateMaxLength = 1;
+    mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &updateMaxLength);
+
+    if (mysql_stmt_execute(stmt) || mysql_stmt_store_result(stmt))
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("query ERROR: %s", mysql_stmt_error(stmt));
+        mysql_free_result(metadata);
+        mysql_stmt_close(stmt);
+        return true;
+    }
+
+    uint64 rowCount = mysql_stmt_num_rows(stmt);
+    uint32 fieldCount = mysql_stmt_field_count(stmt);
+
+    if (rowCount)
+    {
+        MYSQL_FIELD* fields = mysql_fetch_fields(metadata);
+
+        QueryResultMysqlStmt* queryResult = new QueryResultMysqlStmt(fields, rowCount, fieldCount);
+        if (queryResult->Materialize(stmt, fields))
+        {
+            if (pNames)
+            {
+                pNames->resize(fieldCount);
+                for (uint32 i = 0; i < fieldCount; ++i)
+                    (*pNames)[i] = fields[i].name;
+            }
+
+            queryResult->NextRow();
+            *pResult = queryResult;
+        }
+        else
+        {
+            sLog.outErrorDb("SQL: %s", sql);
+            delete queryResult;
+        }
+    }
+
+    DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL (binary): %s", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), sql);
+
+    mysql_stmt_free_result(stmt);
+    mysql_free_result(metadata);
+    mysql_stmt_close(stmt);
+    return true;
+}
+
 QueryResult* MySQLConnection::Query(const char* sql)
 {
+    if (m_db.IsBinaryResults())
+    {
+        QueryResult* queryResult = NULL;
+        if (_QueryStmt(sql, &queryResult, NULL))
+            return queryResult;
+    }
+
     MYSQL_RES* result = NULL;
     MYSQL_FIELD* fields = NULL;
     uint64 rowCount = 0;
@@ -227,6 +320,14 @@ QueryResult* MySQLConnection::Query(const char* sql)
 
 QueryNamedResult* MySQLConnection::QueryNamed(const char* sql)
 {
+    if (m_db.IsBinaryResults())
+    {
+        QueryResult* queryResult = NULL;
+        QueryFieldNames names;
+        if (_QueryStmt(sql, &queryResult, &names))
+            return queryResult ? new QueryNamedResult(queryResult, names) : NULL;
+    }
+
     MYSQL_RES* result = NULL;
     MYSQL_FIELD* fields = NULL;
     uint64 rowCount = 0;
@@ -245,9 +346,53 @@ QueryNamedResult* MySQLConnection::QueryNamed(const char* sql)
     return new QueryNamedResult(queryResult, names);
 }
 
+QueryResult* MySQLConnection::QueryStream(const char* sql)
+{
+    if (!mMysql || _IsStreaming(sql))
+        return NULL;
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    if (mysql_query(mMysql, sql))
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("query ERROR: %s", mysql_error(mMysql));
+        return NULL;
+    }
+    else
+    {
+        DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL (stream): %s", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), sql);
+    }
+
+    MYSQL_RES* result = mysql_use_result(mMysql);
+    if (!result)
+        return NULL;
+
+    // keep connection for this thread until result end
+    mStreamLock = new Lock(this);
+
+    QueryResultMysqlStream* queryResult = new QueryResultMysqlStream(this, result, mysql_fetch_fields(result), mysql_num_fields(result));
+
+    // empty result
+    if (!queryResult->NextRow())
+    {
+        delete queryResult;
+        return NULL;
+    }
+
+    return queryResult;
+}
+
+void MySQLConnection::EndStream()
+{
+    Lock* streamLock = mStreamLock;
+    mStreamLock = NULL;
+    delete streamLock;
+}
+
 bool MySQLConnection::Execute(const char* sql)
 {
-    if (!mMysql)
+    if (!mMysql || _IsStreaming(sql))
         return false;
 
     {
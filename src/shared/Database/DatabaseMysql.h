@@ -69,7 +69,7 @@ class MANGOS_DLL_SPEC MySqlPreparedStatement : public SqlPreparedStatement
 class MANGOS_DLL_SPEC MySQLConnection : public SqlConnection
 {
     public:
-        MySQLConnection(Database& db) : SqlConnection(db), mMysql(NULL) {}
+        MySQLConnection(Database& db) : SqlConnection(db), mMysql(NULL), mStreamLock(NULL) {}
         ~MySQLConnection();
 
         //! Initializes Mysql and connects to a server.
@@ -78,6 +78,7 @@ class MANGOS_DLL_SPEC MySQLConnection : public SqlConnection
 
         QueryResult* Query(const char* sql) override;
         QueryNamedResult* QueryNamed(const char* sql) override;
+        QueryResult* QueryStream(const char* sql) override;
         bool Execute(const char* sql) override;
 
         unsigned long escape_string(char* to, const char* from, unsigned long length);
@@ -86,14 +87,23 @@ class MANGOS_DLL_SPEC MySQLConnection : public SqlConnection
         bool CommitTransaction() override;
         bool RollbackTransaction() override;
 
+        // called by streamed result when all rows read or result deleted
+        void EndStream();
+        uint32 GetErrNo() { return mMysql ? mysql_errno(mMysql) : 0; }
+
     protected:
         SqlPreparedStatement* CreateStatement(const std::string& fmt) override;
 
     private:
         bool _TransactionCmd(const char* sql);
         bool _Query(const char* sql, MYSQL_RES** pResult, MYSQL_FIELD** pFields, uint64* pRowCount, uint32* pFieldCount);
+        // binary protocol query, return false if query can't be prepared and must use text protocol
+        bool _QueryStmt(const char* sql, QueryResult** pResult, QueryFieldNames* pNames);
+
+        bool _IsStreaming(const char* sql) const;
 
         MYSQL* mMysql;
+        Lock* mStreamLock;                                  // set while streamed result not fully read
 };
 
 class MANGOS_DLL_SPEC DatabaseMysql : public Database
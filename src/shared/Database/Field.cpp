@@ -17,3 +17,44 @@
  */
 
 //#include "DatabaseEnv.h"
+
+#include "Field.h"
+
+// shortest "%.*g" text that reads back to the same value, as the server formats FLOAT and DOUBLE
+static void FormatReal(char* buf, size_t size, double value, bool single)
+{
+    for (int precision = single ? 6 : 15; ; ++precision)
+    {
+        snprintf(buf, size, "%.*g", precision, value);
+
+        if (single ? (precision >= 9 || strtof(buf, NULL) == static_cast<float>(value))
+                   : (precision >= 17 || strtod(buf, NULL) == value))
+            return;
+    }
+}
+
+const char* Field::GetBinaryString() const
+{
+    if (!mValue)
+        return NULL;
+
+    if (!mTextReady)
+    {
+        switch (mStorage)
+        {
+            case STORAGE_INT64:
+                snprintf(mText, sizeof(mText), SI64FMTD, mNumeric.i64);
+                break;
+            case STORAGE_UINT64:
+                snprintf(mText, sizeof(mText), UI64FMTD, static_cast<uint64>(mNumeric.i64));
+                break;
+            default:
+                FormatReal(mText, sizeof(mText), mNumeric.d, mStorage == STORAGE_FLOAT);
+                break;
+        }
+
+        mTextReady = true;
+    }
+
+    return mText;
+}
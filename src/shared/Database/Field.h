@@ -34,28 +34,77 @@ class Field
             DB_TYPE_BOOL    = 0x04
         };
 
-        Field() : mValue(NULL), mType(DB_TYPE_UNKNOWN) {}
-        Field(const char* value, enum DataTypes type) : mValue(value), mType(type) {}
+        // how the current value is stored: text from DBMS API or already converted binary value
+        enum StorageTypes
+        {
+            STORAGE_TEXT    = 0x00,
+            STORAGE_INT64   = 0x01,
+            STORAGE_UINT64  = 0x02,
+            STORAGE_DOUBLE  = 0x03,
+            STORAGE_FLOAT   = 0x04                          // FLOAT column, value kept as double
+        };
+
+        Field() : mValue(NULL), mType(DB_TYPE_UNKNOWN), mStorage(STORAGE_TEXT), mTextReady(false) {}
+        Field(const char* value, enum DataTypes type) : mValue(value), mType(type), mStorage(STORAGE_TEXT), mTextReady(false) {}
 
         ~Field() {}
 
         enum DataTypes GetType() const { return mType; }
         bool IsNULL() const { return mValue == NULL; }
 
-        const char* GetString() const { return mValue; }
+        const char* GetString() const { return mStorage == STORAGE_TEXT ? mValue : GetBinaryString(); }
         std::string GetCppString() const
         {
-            return mValue ? mValue : "";                    // std::string s = 0 have undefine result in C++
+            const char* value = GetString();
+            return value ? value : "";                      // std::string s = 0 have undefine result in C++
+        }
+        float GetFloat() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<float>(GetBinaryDouble());
+            return mValue ? static_cast<float>(atof(mValue)) : 0.0f;
+        }
+        bool GetBool() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return GetBinaryInt64() > 0;
+            return mValue ? atoi(mValue) > 0 : false;
+        }
+        int32 GetInt32() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<int32>(GetBinaryInt64());
+            return mValue ? static_cast<int32>(atol(mValue)) : int32(0);
+        }
+        uint8 GetUInt8() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint8>(GetBinaryInt64());
+            return mValue ? static_cast<uint8>(atol(mValue)) : uint8(0);
+        }
+        uint16 GetUInt16() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint16>(GetBinaryInt64());
+            return mValue ? static_cast<uint16>(atol(mValue)) : uint16(0);
+        }
+        int16 GetInt16() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<int16>(GetBinaryInt64());
+            return mValue ? static_cast<int16>(atol(mValue)) : int16(0);
+        }
+        uint32 GetUInt32() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint32>(GetBinaryInt64());
+            return mValue ? static_cast<uint32>(atol(mValue)) : uint32(0);
         }
-        float GetFloat() const { return mValue ? static_cast<float>(atof(mValue)) : 0.0f; }
-        bool GetBool() const { return mValue ? atoi(mValue) > 0 : false; }
-        int32 GetInt32() const { return mValue ? static_cast<int32>(atol(mValue)) : int32(0); }
-        uint8 GetUInt8() const { return mValue ? static_cast<uint8>(atol(mValue)) : uint8(0); }
-        uint16 GetUInt16() const { return mValue ? static_cast<uint16>(atol(mValue)) : uint16(0); }
-        int16 GetInt16() const { return mValue ? static_cast<int16>(atol(mValue)) : int16(0); }
-        uint32 GetUInt32() const { return mValue ? static_cast<uint32>(atol(mValue)) : uint32(0); }
         uint64 GetUInt64() const
         {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint64>(GetBinaryInt64());
+
             uint64 value = 0;
             if (!mValue || sscanf(mValue, UI64FMTD, &value) == -1)
                 return 0;
@@ -66,13 +115,59 @@ class Field
         void SetType(enum DataTypes type) { mType = type; }
         // no need for memory allocations to store resultset field strings
         // all we need is to cache pointers returned by different DBMS APIs
-        void SetValue(const char* value) { mValue = value; };
+        void SetValue(const char* value) { mValue = value; mStorage = STORAGE_TEXT; }
+
+        // binary values from typed result sets, no text parsing at access
+        void SetNull() { mValue = NULL; mStorage = STORAGE_TEXT; }
+        void SetInt64(int64 value) { mNumeric.i64 = value; SetBinary(STORAGE_INT64); }
+        void SetUInt64(uint64 value) { mNumeric.i64 = static_cast<int64>(value); SetBinary(STORAGE_UINT64); }
+        void SetDouble(double value) { mNumeric.d = value; SetBinary(STORAGE_DOUBLE); }
+        void SetFloat(double value) { mNumeric.d = value; SetBinary(STORAGE_FLOAT); }
 
     private:
         Field(Field const&);
         Field& operator=(Field const&);
 
+        void SetBinary(StorageTypes storage)
+        {
+            mStorage = storage;
+            mTextReady = false;
+            mValue = mText;                                 // not NULL, text filled at first GetString() call
+        }
+
+        int64 GetBinaryInt64() const
+        {
+            if (!mValue)
+                return 0;
+            return mStorage == STORAGE_DOUBLE || mStorage == STORAGE_FLOAT ? static_cast<int64>(mNumeric.d) : mNumeric.i64;
+        }
+
+        double GetBinaryDouble() const
+        {
+            if (!mValue)
+                return 0.0;
+
+            switch (mStorage)
+            {
+                case STORAGE_INT64:  return static_cast<double>(mNumeric.i64);
+                case STORAGE_UINT64: return static_cast<double>(static_cast<uint64>(mNumeric.i64));
+                default:             return mNumeric.d;
+            }
+        }
+
+        const char* GetBinaryString() const;
+
         const char* mValue;
         enum DataTypes mType;
+        StorageTypes mStorage;
+
+        union
+        {
+            int64 i64;
+            double d;
+        } mNumeric;
+
+        mutable bool mTextReady;
+        mutable char mText[32];
 };
 #endif
@@ -69,7 +69,57 @@ void QueryResultMysql::EndQuery()
     }
 }
 
-enum Field::DataTypes QueryResultMysql::ConvertNativeType(enum_field_types mysqlType) const
+QueryResultMysqlStream::QueryResultMysqlStream(MySQLConnection* conn, MYSQL_RES* result, MYSQL_FIELD* fields, uint32 fieldCount) :
+    QueryResult(0, fieldCount), mConn(conn), mResult(result)
+{
+    mCurrentRow = new Field[mFieldCount];
+    MANGOS_ASSERT(mCurrentRow);
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+        mCurrentRow[i].SetType(QueryResultMysql::ConvertNativeType(fields[i].type));
+}
+
+QueryResultMysqlStream::~QueryResultMysqlStream()
+{
+    EndQuery();
+}
+
+bool QueryResultMysqlStream::NextRow()
+{
+    if (!mResult)
+        return false;
+
+    MYSQL_ROW row = mysql_fetch_row(mResult);
+    if (!row)
+    {
+        if (uint32 errNo = mConn->GetErrNo())
+            sLog.outErrorDb("SQL ERROR: result streaming stopped with error %u", errNo);
+
+        EndQuery();
+        return false;
+    }
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+        mCurrentRow[i].SetValue(row[i]);
+
+    return true;
+}
+
+void QueryResultMysqlStream::EndQuery()
+{
+    delete[] mCurrentRow;
+    mCurrentRow = 0;
+
+    if (mResult)
+    {
+        // also skip not read rows, required before next query on connection
+        mysql_free_result(mResult);
+        mResult = 0;
+        mConn->EndStream();
+    }
+}
+
+enum Field::DataTypes QueryResultMysql::ConvertNativeType(enum_field_types mysqlType)
 {
     switch (mysqlType)
     {
@@ -99,4 +149,258 @@ enum Field::DataTypes QueryResultMysql::ConvertNativeType(enum_field_types mysql
             return Field::DB_TYPE_UNKNOWN;
     }
 }
+
+QueryResultMysqlStmt::QueryResultMysqlStmt(MYSQL_FIELD* fields, uint64 rowCount, uint32 fieldCount) :
+    QueryResult(rowCount, fieldCount), mColumns(fieldCount), mRow(0)
+{
+    mCurrentRow = new Field[mFieldCount];
+    MANGOS_ASSERT(mCurrentRow);
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+    {
+        mCurrentRow[i].SetType(QueryResultMysql::ConvertNativeType(fields[i].type));
+
+        Column& column = mColumns[i];
+        switch (fields[i].type)
+        {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONGLONG:
+                column.storage = (fields[i].flags & UNSIGNED_FLAG) ? Field::STORAGE_UINT64 : Field::STORAGE_INT64;
+                column.integers.reserve(size_t(mRowCount));
+                column.nulls.reserve(size_t(mRowCount));
+                break;
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+                column.storage = fields[i].type == MYSQL_TYPE_FLOAT ? Field::STORAGE_FLOAT : Field::STORAGE_DOUBLE;
+                column.reals.reserve(size_t(mRowCount));
+                column.nulls.reserve(size_t(mRowCount));
+                break;
+            default:
+                // strings, decimals, dates, enums: same text as text protocol returns
+                column.storage = Field::STORAGE_TEXT;
+                column.offsets.reserve(size_t(mRowCount));
+                break;
+        }
+    }
+}
+
+QueryResultMysqlStmt::~QueryResultMysqlStmt()
+{
+    EndQuery();
+}
+
+bool QueryResultMysqlStmt::Materialize(MYSQL_STMT* stmt, MYSQL_FIELD* fields)
+{
+    MYSQL_BIND* binds = new MYSQL_BIND[mFieldCount];
+    memset(binds, 0, sizeof(MYSQL_BIND) * mFieldCount);
+
+    int64* integers = new int64[mFieldCount];
+    double* reals = new double[mFieldCount];
+    char** strings = new char*[mFieldCount];
+    unsigned long* lengths = new unsigned long[mFieldCount];
+    my_bool* nulls = new my_bool[mFieldCount];
+    my_bool* errors = new my_bool[mFieldCount];
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+    {
+        MYSQL_BIND& bind = binds[i];
+        bind.length = &lengths[i];
+        bind.is_null = &nulls[i];
+        bind.error = &errors[i];
+        strings[i] = NULL;
+
+        switch (mColumns[i].storage)
+        {
+            case Field::STORAGE_INT64:
+            case Field::STORAGE_UINT64:
+                bind.buffer_type = MYSQL_TYPE_LONGLONG;
+                bind.is_unsigned = mColumns[i].storage == Field::STORAGE_UINT64;
+                bind.buffer = &integers[i];
+                break;
+            case Field::STORAGE_DOUBLE:
+            case Field::STORAGE_FLOAT:
+                bind.buffer_type = MYSQL_TYPE_DOUBLE;
+                bind.buffer = &reals[i];
+                break;
+            default:
+                // max_length is known from stored result, longer text (not counted for all types) is fetched again
+                strings[i] = new char[fields[i].max_length + 1];
+                bind.buffer_type = MYSQL_TYPE_STRING;
+                bind.buffer = strings[i];
+                bind.buffer_length = fields[i].max_length + 1;
+                break;
+        }
+    }
+
+    bool ok = !mysql_stmt_bind_result(stmt, binds);
+    if (!ok)
+        sLog.outErrorDb("SQL ERROR: mysql_stmt_bind_result() failed: %s", mysql_stmt_error(stmt));
+
+    while (ok)
+    {
+        int res = mysql_stmt_fetch(stmt);
+        if (res == MYSQL_NO_DATA)
+            break;
+
+        if (res == 1)
+        {
+            sLog.outErrorDb("SQL ERROR: mysql_stmt_fetch() failed: %s", mysql_stmt_error(stmt));
+            ok = false;
+            break;
+        }
+
+        // lengths[i] is the full length of a truncated column, only buffer_length bytes were written
+        std::vector<char> refetched;
+        for (uint32 i = 0; ok && res == MYSQL_DATA_TRUNCATED && i < mFieldCount; ++i)
+        {
+            if (!errors[i])
+                continue;
+
+            if (mColumns[i].storage != Field::STORAGE_TEXT)
+            {
+                sLog.outErrorDb("SQL ERROR: value of column %u truncated by binary protocol", i);
+                ok = false;
+                break;
+            }
+
+            refetched.resize(lengths[i] + 1);
+
+            MYSQL_BIND bind;
+            memset(&bind, 0, sizeof(MYSQL_BIND));
+            bind.buffer_type = MYSQL_TYPE_STRING;
+            bind.buffer = &refetched[0];
+            bind.buffer_length = lengths[i] + 1;
+            bind.length = &lengths[i];
+
+            if (mysql_stmt_fetch_column(stmt, &bind, i, 0))
+            {
+                sLog.outErrorDb("SQL ERROR: mysql_stmt_fetch_column() failed: %s", mysql_stmt_error(stmt));
+                ok = false;
+                break;
+            }
+
+            // swap the larger buffer in, later rows of this column fit into it
+            delete[] strings[i];
+            strings[i] = new char[refetched.size()];
+            memcpy(strings[i], &refetched[0], refetched.size());
+            binds[i].buffer = strings[i];
+            binds[i].buffer_length = refetched.size();
+
+            if (mysql_stmt_bind_result(stmt, binds))
+            {
+                sLog.outErrorDb("SQL ERROR: mysql_stmt_bind_result() failed: %s", mysql_stmt_error(stmt));
+                ok = false;
+                break;
+            }
+        }
+
+        if (!ok)
+            break;
+
+        for (uint32 i = 0; i < mFieldCount; ++i)
+        {
+            Column& column = mColumns[i];
+            switch (column.storage)
+            {
+                case Field::STORAGE_INT64:
+                case Field::STORAGE_UINT64:
+                    column.integers.push_back(integers[i]);
+                    column.nulls.push_back(nulls[i] != 0);
+                    break;
+                case Field::STORAGE_DOUBLE:
+                case Field::STORAGE_FLOAT:
+                    column.reals.push_back(reals[i]);
+                    column.nulls.push_back(nulls[i] != 0);
+                    break;
+                default:
+                    if (nulls[i])
+                        column.offsets.push_back(NULL_OFFSET);
+                    else
+                    {
+                        column.offsets.push_back(uint32(column.strings.size()));
+                        column.strings.insert(column.strings.end(), strings[i], strings[i] + std::min(lengths[i], binds[i].buffer_length));
+                        column.strings.push_back('\0');
+                    }
+                    break;
+            }
+        }
+    }
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+        delete[] strings[i];
+
+    delete[] binds;
+    delete[] integers;
+    delete[] reals;
+    delete[] strings;
+    delete[] lengths;
+    delete[] nulls;
+    delete[] errors;
+
+    return ok;
+}
+
+bool QueryResultMysqlStmt::NextRow()
+{
+    if (!mCurrentRow || mRow >= mRowCount)
+    {
+        EndQuery();
+        return false;
+    }
+
+    size_t row = size_t(mRow);
+    for (uint32 i = 0; i < mFieldCount; ++i)
+    {
+        Column const& column = mColumns[i];
+        Field& field = mCurrentRow[i];
+
+        switch (column.storage)
+        {
+            case Field::STORAGE_INT64:
+                if (column.nulls[row])
+                    field.SetNull();
+                else
+                    field.SetInt64(column.integers[row]);
+                break;
+            case Field::STORAGE_UINT64:
+                if (column.nulls[row])
+                    field.SetNull();
+                else
+                    field.SetUInt64(uint64(column.integers[row]));
+                break;
+            case Field::STORAGE_DOUBLE:
+                if (column.nulls[row])
+                    field.SetNull();
+                else
+                    field.SetDouble(column.reals[row]);
+                break;
+            case Field::STORAGE_FLOAT:
+                if (column.nulls[row])
+                    field.SetNull();
+                else
+                    field.SetFloat(column.reals[row]);
+                break;
+            default:
+                if (column.offsets[row] == NULL_OFFSET)
+                    field.SetNull();
+                else
+                    field.SetValue(&column.strings[column.offsets[row]]);
+                break;
+        }
+    }
+
+    ++mRow;
+    return true;
+}
+
+void QueryResultMysqlStmt::EndQuery()
+{
+    delete[] mCurrentRow;
+    mCurrentRow = 0;
+
+    mColumns.clear();
+}
 #endif
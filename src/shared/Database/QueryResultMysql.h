@@ -30,6 +30,8 @@
 #include <mysql.h>
 #endif
 
+class MySQLConnection;
+
 class QueryResultMysql : public QueryResult
 {
     public:
@@ -39,11 +41,63 @@ class QueryResultMysql : public QueryResult
 
         bool NextRow() override;
 
+        static enum Field::DataTypes ConvertNativeType(enum_field_types mysqlType);
+
+    private:
+        void EndQuery();
+
+        MYSQL_RES* mResult;
+};
+
+// result set read row by row from server (mysql_use_result), only current row is kept in memory
+// the connection is reserved for this result until all rows are read or the result is deleted
+class QueryResultMysqlStream : public QueryResult
+{
+    public:
+        QueryResultMysqlStream(MySQLConnection* conn, MYSQL_RES* result, MYSQL_FIELD* fields, uint32 fieldCount);
+
+        ~QueryResultMysqlStream();
+
+        bool NextRow() override;
+
     private:
-        enum Field::DataTypes ConvertNativeType(enum_field_types mysqlType) const;
         void EndQuery();
 
+        MySQLConnection* mConn;
         MYSQL_RES* mResult;
 };
+
+// result set fetched over the prepared statement (binary) protocol
+// numeric columns are stored already converted, in one array per column
+class QueryResultMysqlStmt : public QueryResult
+{
+    public:
+        QueryResultMysqlStmt(MYSQL_FIELD* fields, uint64 rowCount, uint32 fieldCount);
+
+        ~QueryResultMysqlStmt();
+
+        bool NextRow() override;
+
+        // read all rows from executed statement with stored result
+        bool Materialize(MYSQL_STMT* stmt, MYSQL_FIELD* fields);
+
+    private:
+        struct Column
+        {
+            Field::StorageTypes storage;
+            std::vector<int64> integers;
+            std::vector<double> reals;
+            std::vector<uint32> offsets;                    // text start in strings, NULL_OFFSET for NULL values
+            std::vector<char> strings;
+            std::vector<bool> nulls;
+        };
+
+        enum { NULL_OFFSET = 0xFFFFFFFF };
+
+        void EndQuery();
+
+        std::vector<Column> mColumns;
+        uint64 mRow;
+};
 #endif
 #endif
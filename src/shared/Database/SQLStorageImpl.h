@@ -189,7 +189,8 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
         delete result;
     }
 
-    result = WorldDatabase.PQuery("SELECT * FROM %s", store.GetTableName());
+    // rows converted to records while read from server, no full copy of table text in memory
+    result = WorldDatabase.PQueryStream("SELECT * FROM %s", store.GetTableName());
 
     if (!result)
     {
@@ -75,3 +75,39 @@ void SqlDelayThread::ProcessRequests()
         delete s;
     }
 }
+
+SqlHolderThread::SqlHolderThread(Database* db, SqlConnection* conn) : SqlDelayThread(db, conn), m_wakeup(0)
+{
+}
+
+bool SqlHolderThread::Delay(SqlOperation* sql)
+{
+    SqlDelayThread::Delay(sql);
+    m_wakeup.release();
+    return true;
+}
+
+void SqlHolderThread::Stop()
+{
+    SqlDelayThread::Stop();
+    m_wakeup.release();
+}
+
+void SqlHolderThread::run()
+{
+#ifndef DO_POSTGRESQL
+    mysql_thread_init();
+#endif
+
+    // holder parts are waited on by the delay thread, so execute them as soon as they are queued
+    // the connection itself is kept alive by Database::Ping() called from the delay thread
+    while (m_running)
+    {
+        m_wakeup.acquire();
+        ProcessRequests();
+    }
+
+#ifndef DO_POSTGRESQL
+    mysql_thread_end();
+#endif
+}
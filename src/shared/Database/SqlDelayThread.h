@@ -20,6 +20,7 @@
 #define __SQLDELAYTHREAD_H
 
 #include "ace/Thread_Mutex.h"
+#include "ace/Thread_Semaphore.h"
 #include "LockedQueue.h"
 #include "Threading.h"
 
@@ -36,6 +37,8 @@ class SqlDelayThread : public ACE_Based::Runnable
         SqlQueue m_sqlQueue;                                ///< Queue of SQL statements
         Database* m_dbEngine;                               ///< Pointer to used Database engine
         SqlConnection* m_dbConnection;                      ///< Pointer to DB connection
+
+    protected:
         volatile bool m_running;
 
         // process all enqueued requests
@@ -43,12 +46,27 @@ class SqlDelayThread : public ACE_Based::Runnable
 
     public:
         SqlDelayThread(Database* db, SqlConnection* conn);
-        ~SqlDelayThread();
+        virtual ~SqlDelayThread();
 
         ///< Put sql statement to delay queue
-        bool Delay(SqlOperation* sql) { m_sqlQueue.add(sql); return true; }
+        virtual bool Delay(SqlOperation* sql) { m_sqlQueue.add(sql); return true; }
 
         virtual void Stop();                                ///< Stop event
         virtual void run();                                 ///< Main Thread loop
 };
+
+/// executes query holder parts, sleeps until work is queued and leaves pinging its connection to the delay thread
+class SqlHolderThread : public SqlDelayThread
+{
+    private:
+        ACE_Thread_Semaphore m_wakeup;                      ///< Released for every queued statement and on stop
+
+    public:
+        SqlHolderThread(Database* db, SqlConnection* conn);
+
+        bool Delay(SqlOperation* sql) override;
+
+        void Stop() override;
+        void run() override;
+};
 #endif                                                      //__SQLDELAYTHREAD_H
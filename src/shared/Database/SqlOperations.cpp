@@ -211,18 +211,47 @@ bool SqlQueryHolderEx::Execute(SqlConnection* conn)
     if (!m_holder || !m_callback || !m_queue)
         return false;
 
-    LOCK_DB_CONN(conn);
-    /// we can do this, we are friends
-    std::vector<SqlQueryHolder::SqlResultPair>& queries = m_holder->m_queries;
-    for (size_t i = 0; i < queries.size(); ++i)
+    /// spread the queries over the holder threads, this thread executes the first part itself
+    /// and waits for the others, so later delayed operations still see the holder completed
+    std::vector<SqlDelayThread*> const& helpers = conn->DB().m_holderThreadBodies;
+    size_t parts = std::min(helpers.size() + 1, m_holder->m_queries.size());
+
+    if (parts > 1)
     {
-        /// execute all queries in the holder and pass the results
-        char const* sql = queries[i].first;
-        if (sql) m_holder->SetResult(i, conn->Query(sql));
+        ACE_Thread_Semaphore done(0);
+        for (size_t i = 1; i < parts; ++i)
+            helpers[i - 1]->Delay(new SqlQueryHolderPart(m_holder, i, parts, &done));
+
+        SqlQueryHolderPart::ExecuteQueries(m_holder, conn, 0, parts);
+
+        for (size_t i = 1; i < parts; ++i)
+            done.acquire();
     }
+    else
+        SqlQueryHolderPart::ExecuteQueries(m_holder, conn, 0, 1);
 
     /// sync with the caller thread
     m_queue->add(m_callback);
 
     return true;
 }
+
+bool SqlQueryHolderPart::Execute(SqlConnection* conn)
+{
+    ExecuteQueries(m_holder, conn, m_first, m_step);
+    m_done->release();
+    return true;
+}
+
+void SqlQueryHolderPart::ExecuteQueries(SqlQueryHolder* holder, SqlConnection* conn, size_t first, size_t step)
+{
+    LOCK_DB_CONN(conn);
+    /// we can do this, we are friends
+    std::vector<SqlQueryHolder::SqlResultPair>& queries = holder->m_queries;
+    for (size_t i = first; i < queries.size(); i += step)
+    {
+        /// execute the queries of this part and pass the results, parts never share an index
+        char const* sql = queries[i].first;
+        if (sql) holder->SetResult(i, conn->Query(sql));
+    }
+}
@@ -22,6 +22,7 @@
 #include "Common.h"
 
 #include "ace/Thread_Mutex.h"
+#include "ace/Thread_Semaphore.h"
 #include "LockedQueue.h"
 #include <queue>
 #include "Utilities/Callback.h"
@@ -87,6 +88,7 @@ class QueryResult;                                          /// the result of on
 class SqlResultQueue;                                       /// queue for thread sync
 class SqlQueryHolder;                                       /// groups several async quries
 class SqlQueryHolderEx;                                     /// points to a holder, added to the delay thread
+class SqlQueryHolderPart;                                   /// share of a holder's queries, added to a holder thread
 
 class SqlResultQueue : public ACE_Based::LockedQueue<MaNGOS::IQueryCallback*, ACE_Thread_Mutex>
 {
@@ -111,6 +113,7 @@ class SqlQuery : public SqlOperation
 class SqlQueryHolder
 {
         friend class SqlQueryHolderEx;
+        friend class SqlQueryHolderPart;
     private:
         typedef std::pair<const char*, QueryResult*> SqlResultPair;
         std::vector<SqlResultPair> m_queries;
@@ -136,4 +139,20 @@ class SqlQueryHolderEx : public SqlOperation
             : m_holder(holder), m_callback(callback), m_queue(queue) {}
         bool Execute(SqlConnection* conn) override;
 };
+
+class SqlQueryHolderPart : public SqlOperation
+{
+    private:
+        SqlQueryHolder* m_holder;
+        size_t m_first;                                     /// index of the first query executed
+        size_t m_step;                                      /// distance between executed queries
+        ACE_Thread_Semaphore* m_done;                       /// released once the part is executed
+    public:
+        SqlQueryHolderPart(SqlQueryHolder* holder, size_t first, size_t step, ACE_Thread_Semaphore* done)
+            : m_holder(holder), m_first(first), m_step(step), m_done(done) {}
+        bool Execute(SqlConnection* conn) override;
+
+        /// executes every step-th query of the holder starting at first
+        static void ExecuteQueries(SqlQueryHolder* holder, SqlConnection* conn, size_t first, size_t step);
+};
 #endif                                                      //__SQLOPERATIONS_H